@@ -40,6 +40,29 @@ tmv [OPTION...] [INPUT FILE / URL]
   -f, --fps=[target fps]     Set target fps. Default 15 fps
   -F, --origfps              Use original fps from video. Default 15 fps.
   -s, --no-sound             disable sound.
+  -q, --queue=[frames]       Max decoded frames to buffer. Default 8
+  -M, --queue-mem=[MB]       Max memory for buffered frames. Default 16 MB
+  -t, --threads=[count]      Threads for decoding, scaling and encoding.
+                             Default all cores
+  -c, --colors=[true|256|16] Colors to use. Default from COLORTERM / TERM
+  -m, --mode=[half|quadrant|sextant|braille|ascii]
+                             Glyphs to draw cells with. Default half
+  -g, --graphics=[cells|sixel|kitty]
+                             Draw with text cells, sixel or kitty graphics.
+                             Default cells
+  -D, --dither=[none|ordered|diffuse]
+                             Dithering for 256 / 16 colors. Default ordered
+  -d, --delta=[0-255]        Don't redraw cells that changed less. Default 0
+  -R, --no-rep               don't use REP to repeat cells
+  -A, --no-adapt             don't lower the quality when the terminal can't
+                             keep up
+  -u, --no-sync              don't use synchronized output for videos
+  -L, --no-scroll            don't scroll the terminal for moving content
+  -b, --benchmark            encode without displaying and print encoder speed
+  -S, --stats                print playback stats (dropped frames, a/v offset,
+                             cpu use)
+
+  While playing a video: left / right seek 10 seconds, down / up seek 1 minute
   -?, --help                 Give this help list.
       --usage                Give a short usage message.
   -V, --version              Print program version.
@@ -89,18 +112,41 @@ SOFTWARE.
 #include <signal.h>
 #include <dirent.h>
 #include <argp.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+#include <time.h>
 
 //-------- POSIX libraries ---------------------------------------------------//
 
 #include <sys/stat.h>
-#include <sys/time.h>
+#include <fcntl.h>
+#include <sys/select.h>
 #include <sys/ioctl.h>
-#include<sys/wait.h>
+#include <termios.h>
+#include <sys/mman.h>
 
 //-------- ffmpeg ------------------------------------------------------------//
 
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
+#include <libswscale/swscale.h>
+#include <libswresample/swresample.h>
+#include <libavutil/pixdesc.h>
+#include <libavutil/channel_layout.h>
+
+//-------- zlib --------------------------------------------------------------//
+
+#include <zlib.h>
+
+//-------- simd --------------------------------------------------------------//
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86
+#include <immintrin.h>
+#endif
 
 //-------- external libraries ------------------------------------------------//
 
@@ -108,10 +154,7 @@ SOFTWARE.
 #define STB_IMAGE_IMPLEMENTATION
 #include "include/stb_image.h"
 
-// playing audio files <https://github.com/dr-soft/miniaudio>
-#define DR_WAV_IMPLEMENTATION
-#include "include/dr_wav.h"
-
+// playing audio <https://github.com/dr-soft/miniaudio>
 #define MINIAUDIO_IMPLEMENTATION
 #include "include/miniaudio.h"
 
@@ -127,12 +170,40 @@ char vFormats[][25];
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #define DEFAULT_FPS 15
+
+// the player timeline is in nanoseconds
+#define NS_PER_SEC 1000000000LL
+
+// seconds to seek with the left / right and up / down arrow keys
+#define SEEK_STEP 10
+#define SEEK_STEP_LONG 60
 #define TMP_FOLDER "/tmp/tmv"
 
+// limits of the queue between the decoder and the renderer (whichever is
+// reached first)
+#define QUEUE_FRAMES 8
+#define QUEUE_MB 16
+
 // number of samples to take when scaling (bigger -> better but slow)
 // 1 = nearest neighbor
 #define SCALE 5
 
+// full redraws to time when benchmarking with an image
+#define BENCH_RUNS 100
+
+// cells skipped because of -d are redrawn once their summed error reaches
+// this many frames at the full threshold
+#define DRIFT_LIMIT 8
+
+// a shifted band is only scrolled on the terminal if that saves redrawing at
+// least this many cell rows
+#define SCROLL_MIN_GAIN 2
+
+// frames are encoded in bands of cell rows by up to this many threads, each
+// band getting at least this many cells (smaller frames aren't worth it)
+#define ENCODE_THREADS 8
+#define ENCODE_BAND_CELLS 4096
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 // Types
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -142,14 +213,48 @@ typedef struct VideoInfo
 	int width;
 	int height;
 	int fps;
-	float duration;
+	int64_t duration; // ns
 }VideoInfo;
 
+// colors the terminal can show (24 bit, 256 or 16 color palette)
+enum ColorMode {COLORS_TRUE, COLORS_256, COLORS_16};
+
+// how colors between the palette colors are shown in the indexed modes
+enum Dither {DITHER_NONE, DITHER_ORDERED, DITHER_DIFFUSE};
+
+// sub-pixels per cell: 1 * 2 half blocks, 2 * 2 quadrants, 2 * 3 sextants or
+// 2 * 4 braille dots. Ascii uses 2 * 2 for brightness and edges only.
+enum Mode {MODE_HALF, MODE_QUADRANT, MODE_SEXTANT, MODE_BRAILLE, MODE_ASCII};
+
+// cells (text) or a graphics protocol that draws real pixels
+enum Graphics {GRAPHICS_CELLS, GRAPHICS_SIXEL, GRAPHICS_KITTY};
+
+// options for drawing images and playing videos
+typedef struct Settings
+{
+	int queueFrames;
+	int queueMB;
+	int threads;
+	int benchmark; // encode without showing anything and print timings
+	int rep; // repeat runs of identical cells with CSI REP
+	int threshold; // color change (0 - 255) below which cells aren't redrawn
+	int colors; // ColorMode
+	int dither; // Dither (only used with a palette)
+	int mode; // Mode
+	int graphics; // Graphics
+	int adapt; // lower the quality while the terminal can't keep up
+	int sync; // wrap video frames in synchronized updates if supported
+	int scroll; // scroll the terminal when the content moves up or down
+}Settings;
+
+// packed into 4 bytes so whole rows can be compared with SIMD (the layout
+// matches AV_PIX_FMT_RGB0)
 typedef struct Pixel
 {
-	unsigned short r;
-	unsigned short g;
-	unsigned short b;
+	unsigned char r;
+	unsigned char g;
+	unsigned char b;
+	unsigned char pad;
 }Pixel;
 
 typedef struct Image
@@ -157,12 +262,21 @@ typedef struct Image
 	int width;
 	int height;
 	Pixel *pixels;
+	uint64_t *hashes; // one per row (only for video frames, otherwise NULL)
+
+	// glyph modes: rows 2n and 2n + 1 hold the background and foreground color
+	// of cell row n and this the glyph mask of every cell (otherwise NULL)
+	unsigned char *glyphs;
 }Image;
 
 void freeImage(Image *image)
 {
 	if(image->pixels != NULL) free(image->pixels);
+	if(image->hashes != NULL) free(image->hashes);
+	if(image->glyphs != NULL) free(image->glyphs);
 	image->pixels = NULL;
+	image->hashes = NULL;
+	image->glyphs = NULL;
 }
 
 Image copyImage(Image image)
@@ -170,20 +284,56 @@ Image copyImage(Image image)
 	Image newImage;
 	newImage.width = image.width;
 	newImage.height = image.height;
+	newImage.hashes = NULL;
+	newImage.glyphs = NULL;
 
 	newImage.pixels = malloc((image.width * image.height) * sizeof(Pixel));
 
-	for(int i = 0; i < image.height; i++)
+	memcpy(
+		newImage.pixels, image.pixels,
+		(image.width * image.height) * sizeof(Pixel)
+	);
+	return(newImage);
+}
+
+// hash of a row of pixels, used to skip rows that didn't change
+uint64_t hashRow(const Pixel *ROW, const int WIDTH)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	for(int i = 0; i < WIDTH; i++)
 	{
-		for(int j = 0; j < image.width; j++)
-		{
-			int index = i * image.width + j;
-			newImage.pixels[index].r = image.pixels[index].r;
-			newImage.pixels[index].g = image.pixels[index].g;
-			newImage.pixels[index].b = image.pixels[index].b;
-		}
+		uint32_t value;
+		memcpy(&value, &ROW[i], sizeof(value));
+		hash = (hash ^ value) * 0x100000001b3ULL;
 	}
-	return(newImage);
+
+	return(hash ^ (hash >> 32));
+}
+
+// mixes a row of glyph masks into HASH
+uint64_t hashGlyphs(uint64_t hash, const unsigned char *GLYPHS, const int WIDTH)
+{
+	for(int i = 0; i < WIDTH; i++)
+		hash = (hash ^ GLYPHS[i]) * 0x100000001b3ULL;
+
+	return(hash);
+}
+
+// hash of a whole image (from its row hashes if it has them), used by the
+// graphics protocols to skip frames that didn't change
+uint64_t hashImage(const Image IMAGE)
+{
+	uint64_t hash = 0;
+
+	for(int i = 0; i < IMAGE.height; i++)
+		hash = hash * 31 + (
+			IMAGE.hashes != NULL
+				? IMAGE.hashes[i]
+				: hashRow(IMAGE.pixels + (long)i * IMAGE.width, IMAGE.width)
+		);
+
+	return(hash);
 }
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -225,6 +375,87 @@ void errorFunc(const char *FUNC, const char *FMT, ...)
 
 #define error(a, ...) errorFunc(__func__, (a), ##__VA_ARGS__)
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Stats
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// playback diagnostics, printed on exit with -S
+typedef struct Stats
+{
+	int enabled;
+	long shown;
+	atomic_long dropped;
+
+	// how far the shown frames were from the master clock (video - audio, ns)
+	int64_t avOffset;
+	int64_t avOffsetSum;
+	int64_t avOffsetMax;
+	long avSamples;
+
+	// time the render loop spent sleeping, out of the time it ran (ns)
+	int64_t idleTime;
+	int64_t playTime;
+	int64_t cpuTime; // process cpu time used while playing (all threads)
+
+	// output governor: quality level (0 = best) and the measured drain rate
+	// of the terminal in bytes / second (0 = it always kept up)
+	int governed;
+	int quality;
+	int worstQuality;
+	double drainRate;
+}Stats;
+
+Stats stats;
+
+void addAVOffset(const int64_t OFFSET)
+{
+	stats.avOffset = OFFSET;
+	stats.avOffsetSum += OFFSET;
+	if(llabs(OFFSET) > llabs(stats.avOffsetMax)) stats.avOffsetMax = OFFSET;
+	stats.avSamples++;
+}
+
+void printStats()
+{
+	if(stats.enabled == 0)
+		return;
+
+	printf(
+		"frames: %ld shown, %ld dropped\n",
+		stats.shown, atomic_load(&stats.dropped)
+	);
+
+	if(stats.avSamples > 0)
+		printf(
+			"a/v offset: %+.1f ms avg, %+.1f ms max, %+.1f ms last\n",
+			(double)stats.avOffsetSum / stats.avSamples / 1000000,
+			(double)stats.avOffsetMax / 1000000,
+			(double)stats.avOffset / 1000000
+		);
+	else
+		printf("a/v offset: n/a (no audio)\n");
+
+	if(stats.playTime > 0)
+		printf(
+			"cpu: render loop %.1f%% idle, process %.1f%% of one core\n",
+			100.0 * stats.idleTime / stats.playTime,
+			100.0 * stats.cpuTime / stats.playTime
+		);
+
+	if(stats.governed == 1)
+	{
+		printf(
+			"output: quality level %d, worst %d (0 = best)",
+			stats.quality, stats.worstQuality
+		);
+
+		if(stats.drainRate > 0)
+			printf(", terminal reads %.1f kB/s\n", stats.drainRate / 1000);
+		else
+			printf("\n");
+	}
+}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 // Argp
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -249,6 +480,20 @@ static struct argp_option options[] = {
 	{"origfps", 'F', 0, 0, "Use original fps from video. Default 15 fps", 3},
 	{"no-sound", 's', 0, 0, "disable sound", 3},
 	{"no-info", 'i', 0, 0, "disable progress bar for videos", 3},
+	{"queue", 'q', "[frames]", 0, "Max decoded frames to buffer. Default 8", 4},
+	{"queue-mem", 'M', "[MB]", 0, "Max memory for buffered frames. Default 16 MB", 4},
+	{"threads", 't', "[count]", 0, "Threads for decoding, scaling and encoding. Default all cores", 4},
+	{"colors", 'c', "[true|256|16]", 0, "Colors to use. Default from COLORTERM / TERM", 4},
+	{"mode", 'm', "[half|quadrant|sextant|braille|ascii]", 0, "Glyphs to draw cells with. Default half", 4},
+	{"graphics", 'g', "[cells|sixel|kitty]", 0, "Draw with text cells, sixel or kitty graphics. Default cells", 4},
+	{"dither", 'D', "[none|ordered|diffuse]", 0, "Dithering for 256 / 16 colors. Default ordered", 4},
+	{"delta", 'd', "[0-255]", 0, "Don't redraw cells that changed less than this. Default 0", 4},
+	{"no-rep", 'R', 0, 0, "don't use REP to repeat cells (for terminals without it)", 4},
+	{"no-adapt", 'A', 0, 0, "don't lower the quality (delta, fps) when the terminal can't keep up", 4},
+	{"no-sync", 'u', 0, 0, "don't use synchronized output for videos (even if the terminal has it)", 4},
+	{"no-scroll", 'L', 0, 0, "don't use scroll regions to move content that scrolled up or down", 4},
+	{"benchmark", 'b', 0, 0, "encode without displaying and print encoder speed", 5},
+	{"stats", 'S', 0, 0, "print playback stats (dropped frames, a/v offset, cpu use) on exit", 5},
 	{ 0 }
 };
 
@@ -261,6 +506,7 @@ struct args {
 	int sound;
 	int youtube;
 	int bar;
+	Settings settings;
 };
 
 static error_t parse_option(int key, char *arg, struct argp_state *state)
@@ -298,6 +544,85 @@ static error_t parse_option(int key, char *arg, struct argp_state *state)
 		case 'i':
 			args->bar = 1;
 			break;
+		case 'q':
+			if(atoi(arg) <= 0) error("invalid queue value");
+			args->settings.queueFrames = atoi(arg);
+			break;
+		case 'M':
+			if(atoi(arg) <= 0) error("invalid queue-mem value");
+			args->settings.queueMB = atoi(arg);
+			break;
+		case 't':
+			if(atoi(arg) <= 0) error("invalid threads value");
+			args->settings.threads = atoi(arg);
+			break;
+		case 'S':
+			stats.enabled = 1;
+			break;
+		case 'R':
+			args->settings.rep = 0;
+			break;
+		case 'A':
+			args->settings.adapt = 0;
+			break;
+		case 'u':
+			args->settings.sync = 0;
+			break;
+		case 'L':
+			args->settings.scroll = 0;
+			break;
+		case 'c':
+			if(strcmp(arg, "true") == 0 || strcmp(arg, "24bit") == 0)
+				args->settings.colors = COLORS_TRUE;
+			else if(strcmp(arg, "256") == 0)
+				args->settings.colors = COLORS_256;
+			else if(strcmp(arg, "16") == 0)
+				args->settings.colors = COLORS_16;
+			else
+				error("invalid colors value (use true, 256 or 16)");
+			break;
+		case 'm':
+			if(strcmp(arg, "half") == 0)
+				args->settings.mode = MODE_HALF;
+			else if(strcmp(arg, "quadrant") == 0)
+				args->settings.mode = MODE_QUADRANT;
+			else if(strcmp(arg, "sextant") == 0)
+				args->settings.mode = MODE_SEXTANT;
+			else if(strcmp(arg, "braille") == 0)
+				args->settings.mode = MODE_BRAILLE;
+			else if(strcmp(arg, "ascii") == 0)
+				args->settings.mode = MODE_ASCII;
+			else
+				error("invalid mode (use half, quadrant, sextant, braille or ascii)");
+			break;
+		case 'g':
+			if(strcmp(arg, "cells") == 0)
+				args->settings.graphics = GRAPHICS_CELLS;
+			else if(strcmp(arg, "sixel") == 0)
+				args->settings.graphics = GRAPHICS_SIXEL;
+			else if(strcmp(arg, "kitty") == 0)
+				args->settings.graphics = GRAPHICS_KITTY;
+			else
+				error("invalid graphics value (use cells, sixel or kitty)");
+			break;
+		case 'D':
+			if(strcmp(arg, "none") == 0)
+				args->settings.dither = DITHER_NONE;
+			else if(strcmp(arg, "ordered") == 0)
+				args->settings.dither = DITHER_ORDERED;
+			else if(strcmp(arg, "diffuse") == 0)
+				args->settings.dither = DITHER_DIFFUSE;
+			else
+				error("invalid dither value (use none, ordered or diffuse)");
+			break;
+		case 'd':
+			if(atoi(arg) < 0 || atoi(arg) > 255) error("invalid delta value");
+			args->settings.threshold = atoi(arg);
+			break;
+		case 'b':
+			args->settings.benchmark = 1;
+			args->sound = 0;
+			break;
 		case ARGP_KEY_END:
 			if(args->input == NULL)
 				argp_usage( state );
@@ -332,12 +657,20 @@ int max(int a, int b)
 	else return(b);
 }
 
-float getTime()
+// monotonic time in ns (does not jump with changes to the system clock)
+int64_t getTime()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return((int64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec);
+}
+
+// cpu time used by the whole process in ns
+int64_t getCpuTime()
 {
-	struct timeval tv;
-	gettimeofday(&tv, NULL);
-	long int time = (long int)((tv.tv_sec) * 1000 + (tv.tv_usec) / 1000);
-	return((float)(time % 10000000) / 1000);
+	struct timespec ts;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+	return((int64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec);
 }
 
 // get file extension
@@ -434,20 +767,45 @@ int getDigits(int input)
 // Window
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+// 80 * 24 if stdout isn't a terminal (output captured to a file)
 int getWinWidth()
 {
 	struct winsize size;
-	ioctl(STDOUT_FILENO, TIOCGWINSZ, &size);
+	if(ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == -1 || size.ws_col == 0)
+		return(80);
 	return(size.ws_col);
 }
 
 int getWinHeight()
 {
 	struct winsize size;
-	ioctl(STDOUT_FILENO, TIOCGWINSZ, &size);
+	if(ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == -1 || size.ws_row == 0)
+		return(24 * 2);
 	return((size.ws_row) * 2);
 }
 
+// size of a cell in pixels (for the graphics protocols). Not every terminal
+// reports it, 10 * 20 is a guess for those.
+void getCellSize(int *width, int *height)
+{
+	struct winsize size;
+
+	if(
+		ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 &&
+		size.ws_col > 0 && size.ws_row > 0 &&
+		size.ws_xpixel > 0 && size.ws_ypixel > 0
+	)
+	{
+		*width = size.ws_xpixel / size.ws_col;
+		*height = size.ws_ypixel / size.ws_row;
+	}
+	else
+	{
+		*width = 10;
+		*height = 20;
+	}
+}
+
 // system("clear") doesn't let you scroll back
 void clear()
 {
@@ -455,379 +813,5274 @@ void clear()
 		printf("\n");
 }
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-// Screen
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-------- keyboard ----------------------------------------------------------//
+
+enum Key {KEY_NONE, KEY_LEFT, KEY_RIGHT, KEY_UP, KEY_DOWN};
 
-// only updates changed pixels
-void updateScreen(Image image, Image prevImage)
+struct termios origTermios;
+int rawMode = 0;
+
+// read keys without waiting for enter (and without echoing them)
+void enableRawMode()
 {
-	//Hide cursor (avoids that one white pixel when playing video)
-	printf("\033[?25l");
+	if(isatty(STDIN_FILENO) == 0 || tcgetattr(STDIN_FILENO, &origTermios) != 0)
+		return;
 
-	for(int i = 0; i < image.height - 1; i += 2) // update 2 pixels at once
-	{
-		for(int j = 0; j < image.width - 1; j++)
-		{
-			#define cPixel1 image.pixels[i * image.width + j]
-			#define cPixel2 image.pixels[(i + 1) * image.width + j]
-			#define pPixel1 prevImage.pixels[i * prevImage.width + j]
-			#define pPixel2 prevImage.pixels[(i + 1) * prevImage.width + j]
+	struct termios raw = origTermios;
+	raw.c_lflag &= ~(ICANON | ECHO);
+	raw.c_cc[VMIN] = 0;
+	raw.c_cc[VTIME] = 0;
 
-			// draw only if pixel has changed
-			if(
-				cPixel1.r != pPixel1.r ||
-				cPixel1.g != pPixel1.g ||
-				cPixel1.b != pPixel1.b ||
-				cPixel2.r != pPixel2.r ||
-				cPixel2.g != pPixel2.g ||
-				cPixel2.b != pPixel2.b
-			)
-			{
-				// move cursor
-				printf("\033[%d;%dH", i / 2 + 1, j + 1);
+	if(tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0)
+		rawMode = 1;
+}
 
-				// set foreground and background colors
-				printf("\x1b[48;2;%d;%d;%dm", cPixel1.r, cPixel1.g, cPixel1.b);
-				printf("\x1b[38;2;%d;%d;%dm", cPixel2.r, cPixel2.g, cPixel2.b);
+void disableRawMode()
+{
+	if(rawMode == 1)
+		tcsetattr(STDIN_FILENO, TCSANOW, &origTermios);
+	rawMode = 0;
+}
 
-				printf("▄");
-			}
-		}
+// the start of an escape sequence that hasn't fully arrived yet (over ssh or
+// tmux ESC [ C can come in more than one read)
+char keyBuffer[3];
+int keyLength = 0;
+
+// returns the next key pressed (KEY_NONE if there is none), doesn't block
+enum Key readKey()
+{
+	if(rawMode == 0)
+		return(KEY_NONE);
+
+	while(keyLength < 3)
+	{
+		int count = read(
+			STDIN_FILENO, keyBuffer + keyLength, sizeof(keyBuffer) - keyLength
+		);
+		if(count <= 0)
+			return(KEY_NONE);
+		keyLength += count;
+
+		// arrow keys are sent as ESC [ A-D, anything else is thrown away
+		while(
+			keyLength > 0 &&
+			(keyBuffer[0] != '\033' || (keyLength >= 2 && keyBuffer[1] != '['))
+		)
+			memmove(keyBuffer, keyBuffer + 1, --keyLength);
 	}
-}
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-// Audio
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	keyLength = 0;
 
-void data_callback(
-	ma_device* pDevice, void* pOutput, const void* pInput, ma_uint32 frameCount
-)
+	switch(keyBuffer[2])
+	{
+		case 'A': return(KEY_UP);
+		case 'B': return(KEY_DOWN);
+		case 'C': return(KEY_RIGHT);
+		case 'D': return(KEY_LEFT);
+		default: return(KEY_NONE);
+	}
+}
+
+// sleeps until DEADLINE (see getTime()), until FD can be read (-1 = no FD)
+// or, if KEYS is 1, until a key is pressed
+void waitFor(const int64_t DEADLINE, const int FD, const int KEYS)
 {
-    ma_decoder* pDecoder = (ma_decoder*)pDevice->pUserData;
-    if (pDecoder == NULL) {
-        return;
-    }
+	int64_t wait = DEADLINE - getTime();
+	if(wait <= 0)
+		return;
+
+	struct timespec timeout = {wait / NS_PER_SEC, wait % NS_PER_SEC};
+
+	fd_set fds;
+	FD_ZERO(&fds);
+	int count = 0;
+
+	if(KEYS == 1 && rawMode == 1)
+	{
+		FD_SET(STDIN_FILENO, &fds);
+		count = STDIN_FILENO + 1;
+	}
 
-    ma_decoder_read_pcm_frames(pDecoder, pOutput, frameCount);
+	if(FD != -1)
+	{
+		FD_SET(FD, &fds);
+		count = max(count, FD + 1);
+	}
 
-    (void)pInput;
+	pselect(count, &fds, NULL, NULL, &timeout, NULL);
 }
 
-ma_decoder decoder;
-ma_device device;
+// sleeps until DEADLINE (see getTime()) or until a key is pressed
+void waitUntil(const int64_t DEADLINE)
+{
+	waitFor(DEADLINE, -1, 1);
+}
 
-void playAudio(const char PATH[])
+// sends QUERY and collects the answer in reply (at most SIZE - 1 bytes, 0
+// terminated). A device attributes request goes out after QUERY: every
+// terminal answers that one, so its answer marks the end without waiting for
+// the timeout (half a second, for terminals that ignore QUERY over ssh).
+// Returns the length of the answer, 0 if there is no terminal to ask.
+int queryTerminal(const char *QUERY, char *reply, const int SIZE)
 {
-    ma_result result;
-    ma_device_config deviceConfig;
+	reply[0] = '\0';
 
-    result = ma_decoder_init_file(PATH, NULL, &decoder);
+	if(isatty(STDOUT_FILENO) == 0)
+		return(0);
 
-	if(result != MA_SUCCESS)
-		error("could not initialize decoder (use -s to disable audio)");
+	int wasRaw = rawMode;
+	if(wasRaw == 0) enableRawMode();
+	if(rawMode == 0)
+		return(0);
 
-    deviceConfig = ma_device_config_init(ma_device_type_playback);
-    deviceConfig.playback.format   = decoder.outputFormat;
-    deviceConfig.playback.channels = decoder.outputChannels;
-    deviceConfig.sampleRate        = decoder.outputSampleRate;
-    deviceConfig.dataCallback      = data_callback;
-    deviceConfig.pUserData         = &decoder;
+	fflush(stdout);
+	if(
+		write(STDOUT_FILENO, QUERY, strlen(QUERY)) == -1 ||
+		write(STDOUT_FILENO, "\033[c", 3) == -1
+	)
+	{
+		if(wasRaw == 0) disableRawMode();
+		return(0);
+	}
 
-    result = ma_device_init(NULL, &deviceConfig, &device);
+	int length = 0;
+	int64_t deadline = getTime() + NS_PER_SEC / 2;
 
-	if(result != MA_SUCCESS)
-		error("could not initialize device (use -s to disable audio)");
+	while(length < SIZE - 1 && getTime() < deadline)
+	{
+		waitUntil(deadline);
 
-    result = ma_device_start(&device);
+		int count = read(STDIN_FILENO, reply + length, SIZE - 1 - length);
+		if(count <= 0)
+			continue;
 
-	if(result != MA_SUCCESS)
-		error("could not start device (use -s to disable audio)");
+		length += count;
+		reply[length] = '\0';
+
+		// the device attributes: ESC [ ? ... c
+		char *attributes = strstr(reply, "\033[?");
+		if(attributes != NULL && strchr(attributes, 'c') != NULL)
+			break;
+	}
+
+	if(wasRaw == 0) disableRawMode();
+	return(length);
 }
 
-void stopAudio()
+// asks the terminal (DECRQM) if it has synchronized output (mode 2026). The
+// answer is ESC [ ? 2026 ; Ps $ y, where Ps is 1 (set) or 2 (reset) if it
+// does, and 0 (unknown) or 4 (permanently reset) if it doesn't.
+int probeSyncOutput()
 {
-	ma_device_uninit(&device);
-    ma_decoder_uninit(&decoder);
+	char reply[128];
+	queryTerminal("\033[?2026$p", reply, sizeof(reply));
+
+	return(
+		strstr(reply, "\033[?2026;1$y") != NULL ||
+		strstr(reply, "\033[?2026;2$y") != NULL
+	);
 }
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-// Image
+// Workers
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
-int getImageWidth(const char TARGET[])
+// persistent thread pool, runWorkers() calls JOB once for every index in
+// [0, count) and returns when all calls have finished
+typedef struct Workers
 {
-	int width = -1;
-	stbi_load(TARGET, &width, NULL, NULL, 3);
-	return(width);
-}
+	int count;
+	pthread_t *threads;
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	void (*job)(void *arg, int index);
+	void *arg;
+	int generation;
+	int running;
+	int quit;
+}Workers;
+
+typedef struct WorkerArgs
+{
+	Workers *workers;
+	int index;
+}WorkerArgs;
 
-int getImageHeight(const char TARGET[])
+int getCoreCount()
 {
-	int height = -1;
-	stbi_load(TARGET, NULL, &height, NULL, 3);
-	return(height);
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return(count > 0 ? (int)count : 1);
 }
 
-Image loadImage(const char TARGET[])
+void *workerLoop(void *data)
 {
-	Image image;
-
-	unsigned char *imageRaw = stbi_load(
-		TARGET, &image.width, &image.height, NULL, 3
-	);
-
-	if(imageRaw == NULL)
-		error("could not open %s (it may be corrupt)", TARGET);
+	WorkerArgs args = *(WorkerArgs*)data;
+	free(data);
 
-	image.pixels = (Pixel*)malloc((image.width * image.height) * sizeof(Pixel));
+	Workers *workers = args.workers;
+	int generation = 0;
 
-	if(image.pixels == NULL)
-		error("failed to allocate memory for image");
+	while(1)
+	{
+		pthread_mutex_lock(&workers->lock);
 
-	//debug("allocated mempry for image");
+		while(workers->generation == generation && workers->quit == 0)
+			pthread_cond_wait(&workers->start, &workers->lock);
 
-	// Convert to "Image" type (easier to use)
-	for(int i = 0; i < image.height; i++)
-	{
-		for(int j = 0; j < image.width; j++)
+		if(workers->quit == 1)
 		{
-			image.pixels[i * image.width + j].r
-				= imageRaw[i * image.width * 3 + j * 3];
-			image.pixels[i * image.width + j].g
-				= imageRaw[i * image.width * 3 + j * 3 + 1];
-			image.pixels[i * image.width + j].b
-				= imageRaw[i * image.width * 3 + j * 3 + 2];
+			pthread_mutex_unlock(&workers->lock);
+			return(NULL);
 		}
-	}
 
-	free(imageRaw);
-	return(image);
+		generation = workers->generation;
+		pthread_mutex_unlock(&workers->lock);
+
+		workers->job(workers->arg, args.index);
+
+		pthread_mutex_lock(&workers->lock);
+		if(--workers->running == 0)
+			pthread_cond_signal(&workers->done);
+		pthread_mutex_unlock(&workers->lock);
+	}
 }
 
-Image scaleImage(Image oldImage, float zoomX, float zoomY)
+void startWorkers(Workers *workers, const int COUNT)
 {
-	Image newImage;
-	newImage.width = (int)(oldImage.width * zoomX);
-	newImage.height = (int)(oldImage.height * zoomY);
-	float xPixelWidth = 1 / zoomX;
-	float yPixelWidth = 1 / zoomY;
+	memset(workers, 0, sizeof(Workers));
+	workers->count = COUNT > 0 ? COUNT : 1;
 
-	newImage.pixels
-		= (Pixel*)malloc((newImage.width * newImage.height) * sizeof(Pixel));
+	pthread_mutex_init(&workers->lock, NULL);
+	pthread_cond_init(&workers->start, NULL);
+	pthread_cond_init(&workers->done, NULL);
 
-	if(newImage.pixels == NULL)
-		error("failed to allocate memory for newImage");
+	// the calling thread runs index 0 itself
+	workers->threads = malloc(workers->count * sizeof(pthread_t));
 
-	debug("allocated memory for newImage");
+	if(workers->threads == NULL)
+		error("failed to allocate memory for workers");
 
-	for(int i = 0; i < newImage.height; i++)
+	for(int i = 1; i < workers->count; i++)
 	{
-		for(int j = 0; j < newImage.width; j++)
-		{
-			#define pixel newImage.pixels[i * newImage.width + j]
-			pixel.r = 0;
-			pixel.g = 0;
-			pixel.b = 0;
-			int count = 0;
+		WorkerArgs *args = malloc(sizeof(WorkerArgs));
 
-			// take the average of all points
-			for(float k = 0; k < yPixelWidth; k += yPixelWidth / SCALE)
-			{
-				for(float l = 0; l < xPixelWidth; l += xPixelWidth / SCALE)
-				{
-					#define samplePoint oldImage.pixels\
-					[(int)(floor(i * yPixelWidth + k) * oldImage.width)\
-					 + (int)floor(j * xPixelWidth + l)]
+		if(args == NULL)
+			error("failed to allocate memory for worker args");
 
-					pixel.r += samplePoint.r;
-					pixel.g += samplePoint.g;
-					pixel.b += samplePoint.b;
-					count++;
-				}
-			}
+		args->workers = workers;
+		args->index = i;
 
-			pixel.r = (int)((float)pixel.r / (float)count);
-			pixel.g = (int)((float)pixel.g / (float)count);
-			pixel.b = (int)((float)pixel.b / (float)count);
-		}
+		if(pthread_create(&workers->threads[i], NULL, workerLoop, args) != 0)
+			error("could not start worker thread");
 	}
-	return(newImage);
-}
 
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-// Video
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	debug("started %d workers", workers->count);
+}
 
-void playVideo(const VideoInfo INFO, const int SOUND, const int BAR)
+void runWorkers(Workers *workers, void (*job)(void *arg, int index), void *arg)
 {
-	int height = getWinHeight();
+	if(workers->count == 1)
+	{
+		job(arg, 0);
+		return;
+	}
 
-	debug("tmp folder: %s", TMP_FOLDER);
+	pthread_mutex_lock(&workers->lock);
+	workers->job = job;
+	workers->arg = arg;
+	workers->running = workers->count - 1;
+	workers->generation++;
+	pthread_cond_broadcast(&workers->start);
+	pthread_mutex_unlock(&workers->lock);
 
-	Image prevImage;
-	prevImage.width = INFO.width;
-	prevImage.height = INFO.height;
+	job(arg, 0);
 
-	prevImage.pixels
-		= (Pixel*)malloc((INFO.width * INFO.height) * sizeof(Pixel));
+	pthread_mutex_lock(&workers->lock);
+	while(workers->running > 0)
+		pthread_cond_wait(&workers->done, &workers->lock);
+	pthread_mutex_unlock(&workers->lock);
+}
 
-	if(prevImage.pixels == NULL)
-		error("failed to allocate memory for prevImage");
+void stopWorkers(Workers *workers)
+{
+	pthread_mutex_lock(&workers->lock);
+	workers->quit = 1;
+	pthread_cond_broadcast(&workers->start);
+	pthread_mutex_unlock(&workers->lock);
 
-	debug("allocated memory for prevImage");
+	for(int i = 1; i < workers->count; i++)
+		pthread_join(workers->threads[i], NULL);
 
-	// initialize all colors to -1 to force update when calling updateScreen()
-	// for the first time
-	for(int i = 0; i < INFO.height; i++)
-	{
-		for(int j = 0; j < INFO.width; j++)
-		{
-			prevImage.pixels[i * INFO.width + j].r = -1;
-			prevImage.pixels[i * INFO.width + j].g = -1;
-			prevImage.pixels[i * INFO.width + j].b = -1;
-		}
-	}
+	free(workers->threads);
+	workers->threads = NULL;
 
-	char audioDir[1000];
-	sprintf(audioDir, "%s/audio.wav", TMP_FOLDER);
+	pthread_mutex_destroy(&workers->lock);
+	pthread_cond_destroy(&workers->start);
+	pthread_cond_destroy(&workers->done);
+}
 
-	debug(
-		"starting audio (%s) and video (%d fps)", audioDir, INFO.fps
-	);
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Colors
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// squared distance between two colors, weighted roughly by how sensitive the
+// eye is to each channel (green most, blue least). Scaled so a change of N
+// in every channel gives N * N.
+int colorDistance(const Pixel A, const Pixel B)
+{
+	int r = A.r - B.r;
+	int g = A.g - B.g;
+	int b = A.b - B.b;
+	return((2 * r * r + 4 * g * g + 3 * b * b) / 9);
+}
+
+// guesses what the terminal supports from COLORTERM and TERM. Anything unknown
+// is assumed to be truecolor, like before: TERM=xterm, screen or tmux is what
+// most modern terminals and multiplexers set, so only consoles that really
+// have just 16 colors are downgraded.
+int detectColors()
+{
+	const char *colorterm = getenv("COLORTERM");
+	const char *term = getenv("TERM");
+
+	if(
+		colorterm != NULL &&
+		(strstr(colorterm, "truecolor") != NULL || strstr(colorterm, "24bit") != NULL)
+	)
+		return(COLORS_TRUE);
+
+	if(term == NULL)
+		return(COLORS_TRUE);
+
+	if(strstr(term, "direct") != NULL)
+		return(COLORS_TRUE);
+
+	if(strstr(term, "256") != NULL)
+		return(COLORS_256);
+
+	const char *basic[] = {"linux", "vt100", "vt220", "ansi", "cons25"};
+
+	for(int i = 0; i < (int)(sizeof(basic) / sizeof(basic[0])); i++)
+		if(strcmp(term, basic[i]) == 0)
+			return(COLORS_16);
+
+	return(COLORS_TRUE);
+}
+
+// indexed colors. Pixels are quantized once (before diffing) to the nearest
+// palette color through a lookup table, the index is kept in Pixel.pad.
+typedef struct Palette Palette;
+
+// adds the ordered dither offsets for grid row Y to a row of pixels
+typedef void (*OffsetRow)(const Palette *PALETTE, Pixel *row, const int Y, const int WIDTH);
+
+struct Palette
+{
+	int size;
+	Pixel colors[256];
+	unsigned char *lut; // nearest color for every 5 bit r, g, b
+
+	int dither; // Dither
+	// ordered dither offsets for every position of the 8 * 8 matrix, as signed
+	// values and split into what is added / subtracted (in RGB0 layout, so
+	// rows can be offset with saturating SIMD adds)
+	signed char offsets[8][8];
+	unsigned char add[8][8 * sizeof(Pixel)];
+	unsigned char sub[8][8 * sizeof(Pixel)];
+	OffsetRow offsetRow;
+};
+
+// the 16 colors as xterm shows them by default
+const unsigned char BASIC_COLORS[16][3] = {
+	{0, 0, 0}, {205, 0, 0}, {0, 205, 0}, {205, 205, 0},
+	{0, 0, 238}, {205, 0, 205}, {0, 205, 205}, {229, 229, 229},
+	{127, 127, 127}, {255, 0, 0}, {0, 255, 0}, {255, 255, 0},
+	{92, 92, 255}, {255, 0, 255}, {0, 255, 255}, {255, 255, 255}
+};
+
+int clampByte(const int VALUE)
+{
+	return(VALUE < 0 ? 0 : VALUE > 255 ? 255 : VALUE);
+}
+
+//-------- ordered dithering -------------------------------------------------//
+
+// the offsets only depend on the position of the cell, so a cell that doesn't
+// change keeps its color and the frame diff still works
+
+void offsetRowScalar(
+	const Palette *PALETTE, Pixel *row, const int Y, const int WIDTH
+)
+{
+	const signed char *offsets = PALETTE->offsets[Y & 7];
+
+	for(int i = 0; i < WIDTH; i++)
+	{
+		int offset = offsets[i & 7];
+		row[i].r = clampByte(row[i].r + offset);
+		row[i].g = clampByte(row[i].g + offset);
+		row[i].b = clampByte(row[i].b + offset);
+	}
+}
+
+#ifdef SIMD_X86
+
+// 4 pixels at a time
+__attribute__((target("sse2")))
+void offsetRowSSE2(
+	const Palette *PALETTE, Pixel *row, const int Y, const int WIDTH
+)
+{
+	const unsigned char *add = PALETTE->add[Y & 7];
+	const unsigned char *sub = PALETTE->sub[Y & 7];
+	int i = 0;
+
+	for(; i + 4 <= WIDTH; i += 4)
+	{
+		// the matrix is 8 wide, so i & 7 is either 0 or 4
+		int half = (i & 7) * sizeof(Pixel);
+		__m128i pixels = _mm_loadu_si128((const __m128i*)(row + i));
+
+		pixels = _mm_adds_epu8(
+			pixels, _mm_loadu_si128((const __m128i*)(add + half))
+		);
+		pixels = _mm_subs_epu8(
+			pixels, _mm_loadu_si128((const __m128i*)(sub + half))
+		);
+
+		_mm_storeu_si128((__m128i*)(row + i), pixels);
+	}
+
+	for(; i < WIDTH; i++)
+	{
+		int offset = PALETTE->offsets[Y & 7][i & 7];
+		row[i].r = clampByte(row[i].r + offset);
+		row[i].g = clampByte(row[i].g + offset);
+		row[i].b = clampByte(row[i].b + offset);
+	}
+}
+
+// 8 pixels (one matrix row) at a time
+__attribute__((target("avx2")))
+void offsetRowAVX2(
+	const Palette *PALETTE, Pixel *row, const int Y, const int WIDTH
+)
+{
+	__m256i add = _mm256_loadu_si256((const __m256i*)PALETTE->add[Y & 7]);
+	__m256i sub = _mm256_loadu_si256((const __m256i*)PALETTE->sub[Y & 7]);
+	int i = 0;
+
+	for(; i + 8 <= WIDTH; i += 8)
+	{
+		__m256i pixels = _mm256_loadu_si256((const __m256i*)(row + i));
+		pixels = _mm256_subs_epu8(_mm256_adds_epu8(pixels, add), sub);
+		_mm256_storeu_si256((__m256i*)(row + i), pixels);
+	}
+
+	offsetRowScalar(PALETTE, row + i, Y, WIDTH - i);
+}
+
+#endif
+
+// picks the fastest offset function the cpu supports
+OffsetRow getOffsetRow()
+{
+	#ifdef SIMD_X86
+	__builtin_cpu_init();
+
+	if(__builtin_cpu_supports("avx2"))
+		return(offsetRowAVX2);
+
+	if(__builtin_cpu_supports("sse2"))
+		return(offsetRowSSE2);
+	#endif
+
+	return(offsetRowScalar);
+}
+
+//-------- palette -----------------------------------------------------------//
+
+void initPalette(Palette *palette, const int MODE, const int DITHER)
+{
+	palette->size = MODE == COLORS_16 ? 16 : 256;
+
+	for(int i = 0; i < 16; i++)
+		palette->colors[i] = (Pixel){
+			BASIC_COLORS[i][0], BASIC_COLORS[i][1], BASIC_COLORS[i][2], i
+		};
+
+	if(MODE == COLORS_256)
+	{
+		// 6 * 6 * 6 color cube and 24 grays
+		const unsigned char LEVELS[6] = {0, 95, 135, 175, 215, 255};
+
+		for(int i = 0; i < 216; i++)
+			palette->colors[16 + i] = (Pixel){
+				LEVELS[i / 36], LEVELS[i / 6 % 6], LEVELS[i % 6], 16 + i
+			};
+
+		for(int i = 0; i < 24; i++)
+			palette->colors[232 + i] = (Pixel){
+				8 + i * 10, 8 + i * 10, 8 + i * 10, 232 + i
+			};
+	}
+
+	palette->lut = malloc(32 * 32 * 32);
+
+	if(palette->lut == NULL)
+		error("failed to allocate memory for palette");
+
+	// the first 16 of the 256 colors depend on the terminal theme, so only
+	// the cube and the grays are used
+	int first = MODE == COLORS_256 ? 16 : 0;
+
+	for(int i = 0; i < 32 * 32 * 32; i++)
+	{
+		Pixel pixel = {
+			(i >> 10) << 3 | 4, (i >> 5 & 31) << 3 | 4, (i & 31) << 3 | 4, 0
+		};
+
+		int best = first;
+		int bestDistance = colorDistance(pixel, palette->colors[first]);
+
+		for(int j = first + 1; j < palette->size; j++)
+		{
+			int distance = colorDistance(pixel, palette->colors[j]);
+			if(distance < bestDistance)
+			{
+				best = j;
+				bestDistance = distance;
+			}
+		}
+
+		palette->lut[i] = best;
+	}
+
+	// 8 * 8 bayer matrix, spread over about one step between palette levels
+	palette->dither = DITHER;
+	int spread = MODE == COLORS_16 ? 128 : 40;
+
+	for(int y = 0; y < 8; y++)
+	{
+		for(int x = 0; x < 8; x++)
+		{
+			int bayer = 0;
+			for(int bit = 0; bit < 3; bit++)
+				bayer = bayer * 4
+					+ 2 * ((x ^ y) >> bit & 1)
+					+ (y >> bit & 1);
+
+			int offset = (2 * bayer + 1) * spread / 128 - spread / 2;
+			palette->offsets[y][x] = offset;
+
+			for(int c = 0; c < 3; c++)
+			{
+				palette->add[y][x * sizeof(Pixel) + c] = max(offset, 0);
+				palette->sub[y][x * sizeof(Pixel) + c] = max(-offset, 0);
+			}
+
+			palette->add[y][x * sizeof(Pixel) + 3] = 0;
+			palette->sub[y][x * sizeof(Pixel) + 3] = 0;
+		}
+	}
+
+	palette->offsetRow = getOffsetRow();
+
+	debug("built %d color lookup table", palette->size);
+}
+
+void freePalette(Palette *palette)
+{
+	free(palette->lut);
+	palette->lut = NULL;
+}
+
+Pixel nearestColor(const Palette *PALETTE, const Pixel PIXEL)
+{
+	return(PALETTE->colors[PALETTE->lut[
+		(PIXEL.r >> 3) << 10 | (PIXEL.g >> 3) << 5 | PIXEL.b >> 3
+	]]);
+}
+
+// replaces every pixel of grid row Y with its palette color (and index)
+void quantizeRow(
+	const Palette *PALETTE, Pixel *row, const int Y, const int WIDTH
+)
+{
+	if(PALETTE->dither == DITHER_ORDERED)
+		PALETTE->offsetRow(PALETTE, row, Y, WIDTH);
+
+	for(int i = 0; i < WIDTH; i++)
+		row[i] = nearestColor(PALETTE, row[i]);
+}
+
+//-------- error diffusion ---------------------------------------------------//
+
+// r, g, b and pad error of one cell, in 1/16 (so the whole pixel is updated
+// with a few vector instructions)
+typedef int Error __attribute__((vector_size(4 * sizeof(int))));
+
+// floyd-steinberg (serpentine) on every STEP-th row from FROM to TO of the
+// cell grid. The error doesn't carry over between calls, so bands can be
+// diffused in parallel. Unlike ordered dithering small changes move the noise
+// around, so videos flicker more and need more bandwidth.
+void diffuseRows(
+	const Palette *PALETTE, Image *image,
+	const int FROM, const int TO, const int STEP
+)
+{
+	int width = image->width;
+
+	// one extra cell on each side so the edges don't need checks
+	Error *current = calloc(width + 2, sizeof(Error));
+	Error *next = calloc(width + 2, sizeof(Error));
+
+	if(current == NULL || next == NULL)
+		error("failed to allocate memory for dithering");
+
+	for(int y = FROM; y < TO; y += STEP)
+	{
+		Pixel *row = image->pixels + (long)y * width;
+		int step = (y - FROM) / STEP % 2 == 0 ? 1 : -1;
+		int x = step == 1 ? 0 : width - 1;
+
+		for(int i = 0; i < width; i++, x += step)
+		{
+			Error value = (Error){row[x].r, row[x].g, row[x].b, 0} * 16;
+			value = (value + current[x + 1] + 8) >> 4;
+
+			Pixel pixel = {
+				clampByte(value[0]), clampByte(value[1]), clampByte(value[2]), 0
+			};
+			Pixel color = nearestColor(PALETTE, pixel);
+
+			Error diff
+				= (Error){pixel.r, pixel.g, pixel.b, 0}
+				- (Error){color.r, color.g, color.b, 0};
+
+			current[x + 1 + step] += diff * 7;
+			next[x + 1 - step] += diff * 3;
+			next[x + 1] += diff * 5;
+			next[x + 1 + step] += diff;
+
+			row[x] = color;
+		}
+
+		Error *swap = current;
+		current = next;
+		next = swap;
+		memset(next, 0, (width + 2) * sizeof(Error));
+	}
+
+	free(current);
+	free(next);
+}
+
+// quantizes rows FROM to TO with the dithering set in the palette
+void ditherRows(
+	const Palette *PALETTE, Image *image, const int FROM, const int TO
+)
+{
+	// in the glyph modes rows 2n and 2n + 1 are the background and foreground
+	// colors of a cell, not pixels above each other, so each is diffused on
+	// its own
+	if(PALETTE->dither == DITHER_DIFFUSE && image->glyphs != NULL)
+	{
+		diffuseRows(PALETTE, image, FROM, TO, 2);
+		diffuseRows(PALETTE, image, FROM + 1, TO, 2);
+	}
+	else if(PALETTE->dither == DITHER_DIFFUSE)
+		diffuseRows(PALETTE, image, FROM, TO, 1);
+	else
+		for(int i = FROM; i < TO; i++)
+			quantizeRow(
+				PALETTE, image->pixels + (long)i * image->width, i, image->width
+			);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Glyphs
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// In the glyph modes every cell covers 2 * N sub-pixels. They are split into
+// two colors and a mask (bit y * 2 + x is set for sub-pixels in the
+// foreground color), which is drawn with the matching block / braille glyph.
+
+// lowest and highest value of every channel in each cell
+typedef void (*RangeCells)(
+	const Pixel *SUB, const int STRIDE, const int ROWS, const int CELLS,
+	Pixel *low, Pixel *high
+);
+
+typedef struct Glyphs
+{
+	int width; // sub-pixels per cell
+	int height;
+	int full; // mask with every sub-pixel set
+	int invert; // inverting the mask and swapping the colors looks the same
+	int colored; // 0 = ascii (no colors, the mask is an index into strings)
+	char strings[256][5]; // utf-8 glyph for every mask
+	RangeCells rangeCells;
+}Glyphs;
+
+void allocGlyphs(Image *image)
+{
+	image->glyphs = malloc((long)image->width * (image->height / 2));
+
+	if(image->glyphs == NULL)
+		error("failed to allocate memory for glyphs");
+}
+
+void encodeUtf8(char *string, const unsigned int CODE)
+{
+	if(CODE < 0x80)
+	{
+		string[0] = CODE;
+		string[1] = '\0';
+	}
+	else if(CODE < 0x10000)
+	{
+		string[0] = 0xe0 | CODE >> 12;
+		string[1] = 0x80 | (CODE >> 6 & 0x3f);
+		string[2] = 0x80 | (CODE & 0x3f);
+		string[3] = '\0';
+	}
+	else
+	{
+		string[0] = 0xf0 | CODE >> 18;
+		string[1] = 0x80 | (CODE >> 12 & 0x3f);
+		string[2] = 0x80 | (CODE >> 6 & 0x3f);
+		string[3] = 0x80 | (CODE & 0x3f);
+		string[4] = '\0';
+	}
+}
+
+//-------- cell ranges -------------------------------------------------------//
+
+void rangeCellsScalar(
+	const Pixel *SUB, const int STRIDE, const int ROWS, const int CELLS,
+	Pixel *low, Pixel *high
+)
+{
+	for(int i = 0; i < CELLS; i++)
+	{
+		Pixel lo = SUB[i * 2];
+		Pixel hi = lo;
+
+		for(int y = 0; y < ROWS; y++)
+		{
+			for(int x = 0; x < 2; x++)
+			{
+				Pixel pixel = SUB[y * STRIDE + i * 2 + x];
+				lo.r = pixel.r < lo.r ? pixel.r : lo.r;
+				lo.g = pixel.g < lo.g ? pixel.g : lo.g;
+				lo.b = pixel.b < lo.b ? pixel.b : lo.b;
+				hi.r = pixel.r > hi.r ? pixel.r : hi.r;
+				hi.g = pixel.g > hi.g ? pixel.g : hi.g;
+				hi.b = pixel.b > hi.b ? pixel.b : hi.b;
+			}
+		}
+
+		low[i] = lo;
+		high[i] = hi;
+	}
+}
+
+#ifdef SIMD_X86
+
+// 2 cells at a time
+__attribute__((target("sse2")))
+void rangeCellsSSE2(
+	const Pixel *SUB, const int STRIDE, const int ROWS, const int CELLS,
+	Pixel *low, Pixel *high
+)
+{
+	int i = 0;
+
+	for(; i + 2 <= CELLS; i += 2)
+	{
+		__m128i lo = _mm_loadu_si128((const __m128i*)(SUB + i * 2));
+		__m128i hi = lo;
+
+		for(int y = 1; y < ROWS; y++)
+		{
+			__m128i row
+				= _mm_loadu_si128((const __m128i*)(SUB + y * STRIDE + i * 2));
+			lo = _mm_min_epu8(lo, row);
+			hi = _mm_max_epu8(hi, row);
+		}
+
+		// fold the two columns of each cell, lanes 0 and 2 hold the cells
+		lo = _mm_min_epu8(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+		hi = _mm_max_epu8(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 0, 1)));
+
+		_mm_storel_epi64(
+			(__m128i*)(low + i), _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 3, 2, 0))
+		);
+		_mm_storel_epi64(
+			(__m128i*)(high + i), _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 3, 2, 0))
+		);
+	}
+
+	rangeCellsScalar(SUB + i * 2, STRIDE, ROWS, CELLS - i, low + i, high + i);
+}
+
+#endif
+
+// picks the fastest range function the cpu supports
+RangeCells getRangeCells()
+{
+	#ifdef SIMD_X86
+	__builtin_cpu_init();
+
+	if(__builtin_cpu_supports("sse2"))
+		return(rangeCellsSSE2);
+	#endif
+
+	return(rangeCellsScalar);
+}
+
+//-------- glyph tables ------------------------------------------------------//
+
+const char *QUADRANTS[16] = {
+	" ", "▘", "▝", "▀", "▖", "▌", "▞", "▛",
+	"▗", "▚", "▐", "▜", "▄", "▙", "▟", "█"
+};
+
+// braille dot for every sub-pixel (row by row)
+const unsigned char BRAILLE_DOTS[8] = {
+	0x01, 0x08, 0x02, 0x10, 0x04, 0x20, 0x40, 0x80
+};
+
+// ascii: the index is the brightness of the cell (0 - 15) * 16 + the mask of
+// sub-pixels that are clearly brighter than the rest (0 if the cell is flat)
+const char ASCII_RAMP[] = " .:-=+*#%@";
+
+// edges for the masks above (bit 0 top left, 1 top right, 2 / 3 bottom),
+// '\0' = use the ramp
+const char ASCII_EDGES[16] = {
+	'\0', '`', '\'', '"', ',', '|', '/', '\0',
+	'.', '\\', '|', '\0', '_', '\0', '\0', '\0'
+};
+
+void initAsciiGlyphs(Glyphs *set)
+{
+	for(int i = 0; i < 256; i++)
+	{
+		int level = i >> 4;
+		char glyph = ASCII_EDGES[i & 15];
+
+		// edges in very dark cells would be brighter than the cell
+		if(glyph == '\0' || level < 2)
+			glyph = ASCII_RAMP[level * (int)(sizeof(ASCII_RAMP) - 1) / 16];
+
+		set->strings[i][0] = glyph;
+		set->strings[i][1] = '\0';
+	}
+}
+
+// NULL for half blocks (those are picked by putCell())
+const Glyphs *getGlyphs(const int MODE)
+{
+	static Glyphs glyphs[MODE_ASCII + 1];
+	static int ready[MODE_ASCII + 1] = {0};
+
+	if(MODE == MODE_HALF)
+		return(NULL);
+
+	Glyphs *set = &glyphs[MODE];
+
+	if(ready[MODE] == 1)
+		return(set);
+
+	set->width = 2;
+	set->height = MODE == MODE_SEXTANT ? 3 : MODE == MODE_BRAILLE ? 4 : 2;
+	set->full = (1 << set->width * set->height) - 1;
+
+	// braille dots don't cover the whole cell
+	set->invert = MODE != MODE_BRAILLE && MODE != MODE_ASCII;
+	set->colored = MODE != MODE_ASCII;
+
+	if(MODE == MODE_ASCII)
+	{
+		initAsciiGlyphs(set);
+		ready[MODE] = 1;
+		return(set);
+	}
+
+	for(int mask = 0; mask <= set->full; mask++)
+	{
+		if(MODE == MODE_QUADRANT)
+			strcpy(set->strings[mask], QUADRANTS[mask]);
+		else if(MODE == MODE_SEXTANT)
+		{
+			// U+1FB00 onwards, without the ones that already exist as blocks
+			if(mask == 0)
+				strcpy(set->strings[mask], " ");
+			else if(mask == 21)
+				strcpy(set->strings[mask], "▌");
+			else if(mask == 42)
+				strcpy(set->strings[mask], "▐");
+			else if(mask == 63)
+				strcpy(set->strings[mask], "█");
+			else
+				encodeUtf8(
+					set->strings[mask],
+					0x1fb00 + mask - 1 - (mask > 21) - (mask > 42)
+				);
+		}
+		else
+		{
+			int dots = 0;
+			for(int i = 0; i < 8; i++)
+				if(mask >> i & 1) dots |= BRAILLE_DOTS[i];
+
+			if(dots == 0)
+				strcpy(set->strings[mask], " ");
+			else
+				encodeUtf8(set->strings[mask], 0x2800 + dots);
+		}
+	}
+
+	set->rangeCells = getRangeCells();
+	ready[MODE] = 1;
+
+	return(set);
+}
+
+//-------- fitting -----------------------------------------------------------//
+
+// splits the sub-pixels of one cell (2 wide, STRIDE apart) at the middle of
+// the channel that varies the most and uses the average of each side
+void fitCell(
+	const Glyphs *GLYPHS, const Pixel *SUB, const int STRIDE,
+	const Pixel LOW, const Pixel HIGH,
+	Pixel *bg, Pixel *fg, unsigned char *mask
+)
+{
+	int range[3] = {HIGH.r - LOW.r, HIGH.g - LOW.g, HIGH.b - LOW.b};
+	int channel = range[1] >= range[0] ? 1 : 0;
+	if(range[2] > range[channel]) channel = 2;
+
+	int split = (((const unsigned char*)&LOW)[channel]
+		+ ((const unsigned char*)&HIGH)[channel] + 1) / 2;
+
+	int sum[2][3] = {{0}};
+	int count[2] = {0};
+	int bits = 0;
+
+	for(int y = 0; y < GLYPHS->height; y++)
+	{
+		for(int x = 0; x < 2; x++)
+		{
+			const Pixel *pixel = &SUB[y * STRIDE + x];
+			int on = range[channel] > 0
+				&& ((const unsigned char*)pixel)[channel] >= split;
+
+			bits |= on << (y * 2 + x);
+			sum[on][0] += pixel->r;
+			sum[on][1] += pixel->g;
+			sum[on][2] += pixel->b;
+			count[on]++;
+		}
+	}
+
+	// one color, the foreground doesn't matter
+	if(bits == 0)
+	{
+		*bg = (Pixel){
+			(sum[0][0] + count[0] / 2) / count[0],
+			(sum[0][1] + count[0] / 2) / count[0],
+			(sum[0][2] + count[0] / 2) / count[0],
+			0
+		};
+		*fg = *bg;
+		*mask = 0;
+		return;
+	}
+
+	Pixel colors[2];
+	for(int i = 0; i < 2; i++)
+		colors[i] = (Pixel){
+			(sum[i][0] + count[i] / 2) / count[i],
+			(sum[i][1] + count[i] / 2) / count[i],
+			(sum[i][2] + count[i] / 2) / count[i],
+			0
+		};
+
+	// the top left sub-pixel is always background if that doesn't change
+	// the look, so equal cells always end up with the same colors and mask
+	if(GLYPHS->invert == 1 && (bits & 1) == 1)
+	{
+		*bg = colors[1];
+		*fg = colors[0];
+		*mask = GLYPHS->full & ~bits;
+	}
+	else
+	{
+		*bg = colors[0];
+		*fg = colors[1];
+		*mask = bits;
+	}
+}
+
+// brightness contrast inside a cell that counts as an edge (ascii)
+#define ASCII_EDGE 64
+
+// picks the ascii glyph for one cell (2 * 2 sub-pixels, STRIDE apart)
+unsigned char fitAscii(const Pixel *SUB, const int STRIDE)
+{
+	int luma[4];
+	int sum = 0;
+	int low = 255;
+	int high = 0;
+
+	for(int i = 0; i < 4; i++)
+	{
+		const Pixel *pixel = &SUB[i / 2 * STRIDE + i % 2];
+		luma[i] = (2 * pixel->r + 5 * pixel->g + pixel->b) >> 3;
+		sum += luma[i];
+		low = luma[i] < low ? luma[i] : low;
+		high = luma[i] > high ? luma[i] : high;
+	}
+
+	int mean = sum / 4;
+	int mask = 0;
+
+	if(high - low >= ASCII_EDGE)
+		for(int i = 0; i < 4; i++)
+			mask |= (luma[i] > mean) << i;
+
+	return((mean >> 4) << 4 | mask);
+}
+
+// fits a row of CELLS cells from the sub-pixel rows starting at SUB
+void fitCells(
+	const Glyphs *GLYPHS, const Pixel *SUB, const int STRIDE, const int CELLS,
+	Pixel *bg, Pixel *fg, unsigned char *glyphs
+)
+{
+	// ascii has no colors, only the glyph changes
+	if(GLYPHS->colored == 0)
+	{
+		for(int i = 0; i < CELLS; i++)
+		{
+			bg[i] = (Pixel){0, 0, 0, 0};
+			fg[i] = bg[i];
+			glyphs[i] = fitAscii(SUB + i * 2, STRIDE);
+		}
+		return;
+	}
+
+	Pixel low[64];
+	Pixel high[64];
+
+	for(int from = 0; from < CELLS; from += 64)
+	{
+		int count = min(64, CELLS - from);
+
+		GLYPHS->rangeCells(
+			SUB + from * 2, STRIDE, GLYPHS->height, count, low, high
+		);
+
+		for(int i = 0; i < count; i++)
+			fitCell(
+				GLYPHS, SUB + (from + i) * 2, STRIDE, low[i], high[i],
+				&bg[from + i], &fg[from + i], &glyphs[from + i]
+			);
+	}
+}
+
+// turns an image of sub-pixels into a cell image (see Image)
+Image fitImage(const Glyphs *GLYPHS, Image sub)
+{
+	Image image;
+	image.width = sub.width / GLYPHS->width;
+	image.height = sub.height / GLYPHS->height * 2;
+	image.pixels = malloc((long)image.width * image.height * sizeof(Pixel));
+	image.hashes = NULL;
+
+	if(image.pixels == NULL)
+		error("failed to allocate memory for image");
+
+	allocGlyphs(&image);
+
+	for(int i = 0; i < image.height / 2; i++)
+		fitCells(
+			GLYPHS, sub.pixels + (long)i * GLYPHS->height * sub.width,
+			sub.width, image.width,
+			image.pixels + (long)i * 2 * image.width,
+			image.pixels + (long)(i * 2 + 1) * image.width,
+			image.glyphs + (long)i * image.width
+		);
+
+	return(image);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Screen
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-------- output buffer -----------------------------------------------------//
+
+// a whole frame (image and progress bar) is encoded into this buffer and then
+// sent to the terminal with a single write()
+typedef struct OutBuf
+{
+	char *data;
+	int size;
+	int capacity;
+}OutBuf;
+
+// longest escape sequence written for one cell (cursor move, 2 colors, glyph)
+#define MAX_CELL_BYTES 64
+
+void initOutBuf(OutBuf *out, const int CAPACITY)
+{
+	out->size = 0;
+	out->capacity = CAPACITY;
+	out->data = malloc(CAPACITY);
+
+	if(out->data == NULL)
+		error("failed to allocate memory for output buffer");
+}
+
+void freeOutBuf(OutBuf *out)
+{
+	free(out->data);
+	out->data = NULL;
+	out->size = 0;
+	out->capacity = 0;
+}
+
+// makes room for COUNT more bytes (only grows if the initial size was wrong)
+void reserveOutBuf(OutBuf *out, const int COUNT)
+{
+	if(out->size + COUNT <= out->capacity)
+		return;
+
+	while(out->size + COUNT > out->capacity)
+		out->capacity *= 2;
+
+	out->data = realloc(out->data, out->capacity);
+
+	if(out->data == NULL)
+		error("failed to allocate memory for output buffer");
+}
+
+void putBytes(OutBuf *out, const char *BYTES, const int COUNT)
+{
+	reserveOutBuf(out, COUNT);
+	memcpy(out->data + out->size, BYTES, COUNT);
+	out->size += COUNT;
+}
+
+void putString(OutBuf *out, const char *STRING)
+{
+	putBytes(out, STRING, strlen(STRING));
+}
+
+void putChar(OutBuf *out, const char C)
+{
+	reserveOutBuf(out, 1);
+	out->data[out->size++] = C;
+}
+
+// writes a non negative number in decimal (replaces printf("%d"))
+void putInt(OutBuf *out, unsigned int value)
+{
+	char digits[10];
+	int count = 0;
+
+	do
+	{
+		digits[count++] = '0' + value % 10;
+		value /= 10;
+	}
+	while(value > 0);
+
+	reserveOutBuf(out, count);
+	while(count > 0)
+		out->data[out->size++] = digits[--count];
+}
+
+// moves the cursor to ROW, COL (1 based)
+void putCursor(OutBuf *out, const int ROW, const int COL)
+{
+	putBytes(out, "\033[", 2);
+	putInt(out, ROW);
+	putChar(out, ';');
+	putInt(out, COL);
+	putChar(out, 'H');
+}
+
+// writes the "r;g;b" part of a 24 bit color sequence
+void putRGB(OutBuf *out, const Pixel PIXEL)
+{
+	putInt(out, PIXEL.r);
+	putChar(out, ';');
+	putInt(out, PIXEL.g);
+	putChar(out, ';');
+	putInt(out, PIXEL.b);
+}
+
+// sends the buffer to FD and empties it, returns the number of bytes sent
+int flushOutBuf(OutBuf *out, const int FD)
+{
+	// anything still sitting in stdio has to go out first
+	fflush(stdout);
+
+	int sent = 0;
+	while(sent < out->size)
+	{
+		ssize_t count = write(FD, out->data + sent, out->size - sent);
+
+		if(count < 0 && errno == EINTR)
+			continue;
+		if(count <= 0)
+			break;
+
+		sent += count;
+	}
+
+	out->size = 0;
+	return(sent);
+}
+
+//-------- diff --------------------------------------------------------------//
+
+// the diff functions set one bit in MASK for every cell of a row (a top and a
+// bottom pixel) that changed, and return 1 if any did
+typedef int (*DiffRow)(
+	const Pixel *TOP, const Pixel *BOTTOM,
+	const Pixel *PREV_TOP, const Pixel *PREV_BOTTOM,
+	const int WIDTH, uint64_t *mask
+);
+
+// compares the cells from FROM to WIDTH one by one (mask must be cleared)
+int diffCells(
+	const Pixel *TOP, const Pixel *BOTTOM,
+	const Pixel *PREV_TOP, const Pixel *PREV_BOTTOM,
+	const int FROM, const int WIDTH, uint64_t *mask
+)
+{
+	int changed = 0;
+
+	for(int j = FROM; j < WIDTH; j++)
+	{
+		if(
+			memcmp(&TOP[j], &PREV_TOP[j], sizeof(Pixel)) != 0 ||
+			memcmp(&BOTTOM[j], &PREV_BOTTOM[j], sizeof(Pixel)) != 0
+		)
+		{
+			mask[j / 64] |= 1ULL << (j % 64);
+			changed = 1;
+		}
+	}
+
+	return(changed);
+}
+
+int diffRowScalar(
+	const Pixel *TOP, const Pixel *BOTTOM,
+	const Pixel *PREV_TOP, const Pixel *PREV_BOTTOM,
+	const int WIDTH, uint64_t *mask
+)
+{
+	memset(mask, 0, (WIDTH + 63) / 64 * sizeof(uint64_t));
+	return(diffCells(TOP, BOTTOM, PREV_TOP, PREV_BOTTOM, 0, WIDTH, mask));
+}
+
+#ifdef SIMD_X86
+
+// 4 cells at a time
+__attribute__((target("sse2")))
+int diffRowSSE2(
+	const Pixel *TOP, const Pixel *BOTTOM,
+	const Pixel *PREV_TOP, const Pixel *PREV_BOTTOM,
+	const int WIDTH, uint64_t *mask
+)
+{
+	memset(mask, 0, (WIDTH + 63) / 64 * sizeof(uint64_t));
+	uint64_t changed = 0;
+	int j = 0;
+
+	for(; j + 4 <= WIDTH; j += 4)
+	{
+		__m128i top = _mm_loadu_si128((const __m128i*)(TOP + j));
+		__m128i bottom = _mm_loadu_si128((const __m128i*)(BOTTOM + j));
+		__m128i prevTop = _mm_loadu_si128((const __m128i*)(PREV_TOP + j));
+		__m128i prevBottom = _mm_loadu_si128((const __m128i*)(PREV_BOTTOM + j));
+
+		__m128i same = _mm_and_si128(
+			_mm_cmpeq_epi32(top, prevTop), _mm_cmpeq_epi32(bottom, prevBottom)
+		);
+
+		uint64_t bits = ~_mm_movemask_ps(_mm_castsi128_ps(same)) & 0xf;
+		mask[j / 64] |= bits << (j % 64);
+		changed |= bits;
+	}
+
+	return(
+		diffCells(TOP, BOTTOM, PREV_TOP, PREV_BOTTOM, j, WIDTH, mask)
+		| (changed != 0)
+	);
+}
+
+// 8 cells at a time
+__attribute__((target("avx2")))
+int diffRowAVX2(
+	const Pixel *TOP, const Pixel *BOTTOM,
+	const Pixel *PREV_TOP, const Pixel *PREV_BOTTOM,
+	const int WIDTH, uint64_t *mask
+)
+{
+	memset(mask, 0, (WIDTH + 63) / 64 * sizeof(uint64_t));
+	uint64_t changed = 0;
+	int j = 0;
+
+	for(; j + 8 <= WIDTH; j += 8)
+	{
+		__m256i top = _mm256_loadu_si256((const __m256i*)(TOP + j));
+		__m256i bottom = _mm256_loadu_si256((const __m256i*)(BOTTOM + j));
+		__m256i prevTop = _mm256_loadu_si256((const __m256i*)(PREV_TOP + j));
+		__m256i prevBottom
+			= _mm256_loadu_si256((const __m256i*)(PREV_BOTTOM + j));
+
+		__m256i same = _mm256_and_si256(
+			_mm256_cmpeq_epi32(top, prevTop),
+			_mm256_cmpeq_epi32(bottom, prevBottom)
+		);
+
+		uint64_t bits = ~_mm256_movemask_ps(_mm256_castsi256_ps(same)) & 0xff;
+		mask[j / 64] |= bits << (j % 64);
+		changed |= bits;
+	}
+
+	return(
+		diffCells(TOP, BOTTOM, PREV_TOP, PREV_BOTTOM, j, WIDTH, mask)
+		| (changed != 0)
+	);
+}
+
+#endif
+
+// picks the fastest diff the cpu supports
+DiffRow getDiffRow()
+{
+	#ifdef SIMD_X86
+	__builtin_cpu_init();
+
+	if(__builtin_cpu_supports("avx2"))
+		return(diffRowAVX2);
+
+	if(__builtin_cpu_supports("sse2"))
+		return(diffRowSSE2);
+	#endif
+
+	return(diffRowScalar);
+}
+
+// sets the bits of cells whose glyph changed (glyph modes)
+int diffGlyphs(
+	const unsigned char *GLYPHS, const unsigned char *PREV_GLYPHS,
+	const int WIDTH, uint64_t *mask
+)
+{
+	if(memcmp(GLYPHS, PREV_GLYPHS, WIDTH) == 0)
+		return(0);
+
+	for(int j = 0; j < WIDTH; j++)
+		if(GLYPHS[j] != PREV_GLYPHS[j])
+			mask[j / 64] |= 1ULL << (j % 64);
+
+	return(1);
+}
+
+//-------- encoder -----------------------------------------------------------//
+
+// what the terminal is currently set to, so only what changed is sent
+typedef struct Encoder
+{
+	int rep; // use CSI REP for runs of identical cells
+	int scroll; // scroll bands that moved (DECSTBM + SU / SD)
+	int threshold; // squared, see colorDistance()
+	int colors; // ColorMode (indexed modes use Pixel.pad)
+	const Glyphs *glyphs; // NULL = half blocks
+
+	Pixel fg;
+	Pixel bg;
+	int fgSet; // 0 = unknown
+	int bgSet;
+	int row; // where the next character will be drawn (-1 = unknown)
+	int col;
+
+	// set to draw the next frame in full (the screen content is unknown)
+	int redraw;
+
+	DiffRow diffRow;
+	uint64_t *mask; // changed cells of the current row
+
+	// row hashes of the frame on screen (hashCount = 0 if it had none)
+	uint64_t *hashes;
+	int hashCount;
+
+	// changedRows[n] = cell rows above row n that differ from the screen
+	int *changedRows;
+
+	// cell rows where -d held back changes in the last frame. Their hashes
+	// don't match what is on screen, so they can't be skipped by hash.
+	unsigned char *heldRows;
+
+	// error of every cell that was left alone since it was last drawn
+	unsigned int *drift;
+	int width;
+
+	// big frames are split into bands of rows that are encoded in parallel
+	// (workers = NULL encodes on the calling thread)
+	Workers *workers;
+	struct EncoderBand *bands;
+
+	// current job
+	Image image;
+	Image prevImage;
+	int useHashes;
+	int exposedFrom; // rows left blank by a scroll
+	int exposedTo;
+}Encoder;
+
+// a band starts with the colors and cursor position unknown, so its output is
+// correct no matter what the band before it ended with
+typedef struct EncoderBand
+{
+	Encoder encoder; // copy of the main one with its own mask
+	uint64_t *mask;
+	OutBuf out;
+	int from; // cell rows
+	int to;
+}EncoderBand;
+
+void initEncoder(
+	Encoder *encoder, const int WIDTH, const int HEIGHT,
+	const Settings SETTINGS
+)
+{
+	encoder->rep = SETTINGS.rep;
+	encoder->scroll = SETTINGS.scroll;
+	encoder->threshold = SETTINGS.threshold * SETTINGS.threshold;
+	encoder->colors = SETTINGS.colors;
+	encoder->glyphs = getGlyphs(SETTINGS.mode);
+	encoder->fgSet = 0;
+	encoder->bgSet = 0;
+	encoder->row = -1;
+	encoder->col = -1;
+	encoder->redraw = 1;
+
+	encoder->diffRow = getDiffRow();
+	encoder->mask = malloc((WIDTH + 63) / 64 * sizeof(uint64_t));
+	encoder->hashes = malloc(HEIGHT * sizeof(uint64_t));
+	encoder->hashCount = 0;
+	encoder->changedRows = malloc((HEIGHT / 2 + 1) * sizeof(int));
+	encoder->heldRows = calloc(HEIGHT / 2 + 1, 1);
+
+	encoder->width = WIDTH;
+	encoder->drift = calloc((long)WIDTH * (HEIGHT / 2 + 1), sizeof(int));
+
+	encoder->workers = NULL;
+	encoder->bands = NULL;
+
+	if(
+		encoder->mask == NULL ||
+		encoder->hashes == NULL ||
+		encoder->changedRows == NULL ||
+		encoder->heldRows == NULL ||
+		encoder->drift == NULL
+	)
+		error("failed to allocate memory for encoder");
+}
+
+// threads worth using to encode frames of WIDTH * HEIGHT pixels (at most
+// THREADS, 1 = encode on the calling thread)
+int encodeThreads(const int WIDTH, const int HEIGHT, const int THREADS)
+{
+	long cells = (long)WIDTH * (HEIGHT / 2);
+	long threads = cells / ENCODE_BAND_CELLS;
+
+	if(threads > THREADS) threads = THREADS;
+	if(threads > ENCODE_THREADS) threads = ENCODE_THREADS;
+
+	return(threads > 1 ? (int)threads : 1);
+}
+
+// lets updateScreen() split frames between WORKERS (one band per worker)
+void shareEncoder(Encoder *encoder, Workers *workers)
+{
+	encoder->workers = workers;
+	encoder->bands = malloc(workers->count * sizeof(EncoderBand));
+
+	if(encoder->bands == NULL)
+		error("failed to allocate memory for encoder bands");
+
+	for(int i = 0; i < workers->count; i++)
+	{
+		EncoderBand *band = encoder->bands + i;
+		band->mask = malloc((encoder->width + 63) / 64 * sizeof(uint64_t));
+		initOutBuf(&band->out, encoder->width * MAX_CELL_BYTES);
+
+		if(band->mask == NULL)
+			error("failed to allocate memory for encoder bands");
+	}
+}
+
+void freeEncoder(Encoder *encoder)
+{
+	if(encoder->bands != NULL)
+	{
+		for(int i = 0; i < encoder->workers->count; i++)
+		{
+			free(encoder->bands[i].mask);
+			freeOutBuf(&encoder->bands[i].out);
+		}
+
+		free(encoder->bands);
+		encoder->bands = NULL;
+	}
+
+	free(encoder->mask);
+	free(encoder->hashes);
+	free(encoder->changedRows);
+	free(encoder->heldRows);
+	free(encoder->drift);
+	encoder->mask = NULL;
+	encoder->hashes = NULL;
+	encoder->changedRows = NULL;
+	encoder->heldRows = NULL;
+	encoder->drift = NULL;
+}
+
+int samePixel(const Pixel A, const Pixel B)
+{
+	return(A.r == B.r && A.g == B.g && A.b == B.b);
+}
+
+// clears the cells in MASK that changed by less than the threshold (see -d),
+// unless they have been off for long enough to add up to a visible error.
+// Returns 1 if any changed cells are left.
+int filterChanges(
+	Encoder *encoder, const int ROW,
+	const Pixel *TOP, const Pixel *BOTTOM,
+	const Pixel *PREV_TOP, const Pixel *PREV_BOTTOM,
+	const unsigned char *GLYPHS, const unsigned char *PREV_GLYPHS,
+	const int WIDTH, uint64_t *mask
+)
+{
+	unsigned int *drift = encoder->drift + (long)ROW * encoder->width;
+	unsigned int threshold = encoder->threshold;
+	int changed = 0;
+
+	for(int word = 0; word < (WIDTH + 63) / 64; word++)
+	{
+		uint64_t bits = mask[word];
+
+		while(bits != 0)
+		{
+			int j = word * 64 + __builtin_ctzll(bits);
+			bits &= bits - 1;
+
+			// a different glyph is never a small change
+			if(GLYPHS != NULL && GLYPHS[j] != PREV_GLYPHS[j])
+			{
+				changed = 1;
+				continue;
+			}
+
+			unsigned int error = max(
+				colorDistance(TOP[j], PREV_TOP[j]),
+				colorDistance(BOTTOM[j], PREV_BOTTOM[j])
+			);
+
+			if(
+				error <= threshold &&
+				drift[j] + error < DRIFT_LIMIT * threshold
+			)
+			{
+				drift[j] += error;
+				mask[word] &= ~(1ULL << (j % 64));
+				encoder->heldRows[ROW] = 1;
+			}
+			else
+				changed = 1;
+		}
+	}
+
+	return(changed);
+}
+
+// a cell is being drawn, so what is on screen matches the frame again
+void drawnCells(
+	Encoder *encoder, const int ROW, const int FROM, const int COUNT,
+	Pixel *prevTop, Pixel *prevBottom, unsigned char *prevGlyphs,
+	const Pixel *TOP, const Pixel *BOTTOM, const unsigned char *GLYPHS
+)
+{
+	memcpy(prevTop + FROM, TOP + FROM, COUNT * sizeof(Pixel));
+	memcpy(prevBottom + FROM, BOTTOM + FROM, COUNT * sizeof(Pixel));
+	if(GLYPHS != NULL) memcpy(prevGlyphs + FROM, GLYPHS + FROM, COUNT);
+	memset(
+		encoder->drift + (long)ROW * encoder->width + FROM, 0,
+		COUNT * sizeof(int)
+	);
+}
+
+// the SGR parameters for one color in the encoder's color mode
+void putColor(
+	Encoder *encoder, OutBuf *out, const Pixel COLOR, const int BACKGROUND
+)
+{
+	if(encoder->colors == COLORS_TRUE)
+	{
+		putBytes(out, BACKGROUND == 1 ? "48;2;" : "38;2;", 5);
+		putRGB(out, COLOR);
+	}
+	else if(encoder->colors == COLORS_256)
+	{
+		putBytes(out, BACKGROUND == 1 ? "48;5;" : "38;5;", 5);
+		putInt(out, COLOR.pad);
+	}
+	else
+	{
+		// 30 - 37 / 40 - 47, bright ones are 90 - 97 / 100 - 107
+		int base = COLOR.pad < 8 ? 30 : 90 - 8;
+		putInt(out, base + COLOR.pad + (BACKGROUND == 1 ? 10 : 0));
+	}
+}
+
+// sends a single SGR for the colors that differ from the current ones (NULL =
+// don't care)
+void setColors(Encoder *encoder, OutBuf *out, const Pixel *BG, const Pixel *FG)
+{
+	int setBg = BG != NULL
+		&& (encoder->bgSet == 0 || samePixel(encoder->bg, *BG) == 0);
+	int setFg = FG != NULL
+		&& (encoder->fgSet == 0 || samePixel(encoder->fg, *FG) == 0);
+
+	if(setBg == 0 && setFg == 0)
+		return;
+
+	putBytes(out, "\x1b[", 2);
+
+	if(setBg == 1)
+	{
+		putColor(encoder, out, *BG, 1);
+		encoder->bg = *BG;
+		encoder->bgSet = 1;
+	}
+
+	if(setFg == 1)
+	{
+		if(setBg == 1) putChar(out, ';');
+		putColor(encoder, out, *FG, 0);
+		encoder->fg = *FG;
+		encoder->fgSet = 1;
+	}
+
+	putChar(out, 'm');
+}
+
+// draws a cell of a glyph mode (BG and FG color and MASK, see Glyphs)
+const char *putGlyph(
+	Encoder *encoder, OutBuf *out,
+	const Pixel BG, const Pixel FG, const int MASK
+)
+{
+	const Glyphs *glyphs = encoder->glyphs;
+
+	if(glyphs->colored == 0)
+	{
+		putString(out, glyphs->strings[MASK]);
+		return(glyphs->strings[MASK]);
+	}
+
+	int bgBg = encoder->bgSet == 1 && samePixel(encoder->bg, BG);
+	int fgBg = encoder->fgSet == 1 && samePixel(encoder->fg, BG);
+
+	const char *glyph;
+
+	if(MASK == 0)
+	{
+		if(glyphs->invert == 1 && bgBg == 0 && fgBg == 1)
+			glyph = glyphs->strings[glyphs->full];
+		else
+		{
+			setColors(encoder, out, &BG, NULL);
+			glyph = " ";
+		}
+	}
+	else
+	{
+		int bgFg = encoder->bgSet == 1 && samePixel(encoder->bg, FG);
+		int fgFg = encoder->fgSet == 1 && samePixel(encoder->fg, FG);
+
+		if(glyphs->invert == 1 && bgFg + fgBg > bgBg + fgFg)
+		{
+			setColors(encoder, out, &FG, &BG);
+			glyph = glyphs->strings[glyphs->full & ~MASK];
+		}
+		else
+		{
+			setColors(encoder, out, &BG, &FG);
+			glyph = glyphs->strings[MASK];
+		}
+	}
+
+	putString(out, glyph);
+	return(glyph);
+}
+
+// draws one cell (TOP and BOTTOM pixel, or colors and MASK in the glyph
+// modes) and returns the glyph used. The glyph is picked so that as few
+// colors as possible have to be changed.
+const char *putCell(
+	Encoder *encoder, OutBuf *out,
+	const Pixel TOP, const Pixel BOTTOM, const int MASK
+)
+{
+	if(encoder->glyphs != NULL)
+		return(putGlyph(encoder, out, TOP, BOTTOM, MASK));
+
+	int bgTop = encoder->bgSet == 1 && samePixel(encoder->bg, TOP);
+	int fgTop = encoder->fgSet == 1 && samePixel(encoder->fg, TOP);
+
+	const char *glyph;
+
+	if(samePixel(TOP, BOTTOM))
+	{
+		// one color: a space in the background or a full block in the
+		// foreground color
+		if(bgTop == 0 && fgTop == 1)
+			glyph = "█";
+		else
+		{
+			setColors(encoder, out, &TOP, NULL);
+			glyph = " ";
+		}
+	}
+	else
+	{
+		int bgBottom = encoder->bgSet == 1 && samePixel(encoder->bg, BOTTOM);
+		int fgBottom = encoder->fgSet == 1 && samePixel(encoder->fg, BOTTOM);
+
+		// ▄ shows the bottom pixel in the foreground color, ▀ the top one
+		if(bgBottom + fgTop > bgTop + fgBottom)
+		{
+			setColors(encoder, out, &BOTTOM, &TOP);
+			glyph = "▀";
+		}
+		else
+		{
+			setColors(encoder, out, &TOP, &BOTTOM);
+			glyph = "▄";
+		}
+	}
+
+	putString(out, glyph);
+	return(glyph);
+}
+
+// repeats the last glyph COUNT more times, with REP when that is shorter
+void putRepeat(
+	Encoder *encoder, OutBuf *out, const char *GLYPH, const int COUNT
+)
+{
+	int glyphBytes = strlen(GLYPH);
+
+	if(encoder->rep == 1 && COUNT * glyphBytes > 3 + getDigits(COUNT))
+	{
+		putBytes(out, "\x1b[", 2);
+		putInt(out, COUNT);
+		putChar(out, 'b');
+		return;
+	}
+
+	for(int i = 0; i < COUNT; i++)
+		putBytes(out, GLYPH, glyphBytes);
+}
+
+// cursor movements (CSI n C/D/B/E), the count is left out when it is 1
+void putMove(OutBuf *out, const int COUNT, const char CMD)
+{
+	putBytes(out, "\x1b[", 2);
+	if(COUNT > 1) putInt(out, COUNT);
+	putChar(out, CMD);
+}
+
+int moveBytes(const int COUNT)
+{
+	return(COUNT > 1 ? 3 + getDigits(COUNT) : 3);
+}
+
+// ways of getting to the next cell, cheapest one is used
+enum Vertical {MOVE_NONE, MOVE_CUD, MOVE_NEWLINE, MOVE_CNL};
+enum Horizontal {MOVE_STAY, MOVE_CUF, MOVE_CUB, MOVE_CR};
+
+// moves the cursor from where the encoder left it to ROW, COL (0 based) with
+// as few bytes as possible, returns the number of bytes. Nothing is written
+// if out is NULL.
+int moveCursor(Encoder *encoder, OutBuf *out, const int ROW, const int COL)
+{
+	int rows = ROW - encoder->row;
+
+	// absolute position (the column can be left out for the first one)
+	int best = 3 + getDigits(ROW + 1) + (COL > 0 ? 1 + getDigits(COL + 1) : 0);
+	int bestVertical = -1;
+	int bestHorizontal = -1;
+
+	if(encoder->row != -1 && rows >= 0)
+	{
+		for(int v = MOVE_NONE; v <= MOVE_CNL; v++)
+		{
+			if((v == MOVE_NONE) != (rows == 0))
+				continue;
+
+			int cost = 0;
+			int col = encoder->col;
+
+			if(v == MOVE_CUD) cost = moveBytes(rows);
+			if(v == MOVE_NEWLINE) {cost = rows * 2; col = 0;}
+			if(v == MOVE_CNL) {cost = moveBytes(rows); col = 0;}
+
+			for(int h = MOVE_STAY; h <= MOVE_CR; h++)
+			{
+				int total = cost;
+
+				if(h == MOVE_STAY && COL != col) continue;
+				if(h == MOVE_CUF && COL <= col) continue;
+				if(h == MOVE_CUB && COL >= col) continue;
+				if(h == MOVE_CR && col == 0) continue;
+
+				if(h == MOVE_CUF) total += moveBytes(COL - col);
+				if(h == MOVE_CUB) total += moveBytes(col - COL);
+				if(h == MOVE_CR) total += 1 + (COL > 0 ? moveBytes(COL) : 0);
+
+				if(total < best)
+				{
+					best = total;
+					bestVertical = v;
+					bestHorizontal = h;
+				}
+			}
+		}
+	}
+
+	if(out == NULL)
+		return(best);
+
+	if(bestVertical == -1)
+	{
+		putBytes(out, "\x1b[", 2);
+		putInt(out, ROW + 1);
+		if(COL > 0)
+		{
+			putChar(out, ';');
+			putInt(out, COL + 1);
+		}
+		putChar(out, 'H');
+		return(best);
+	}
+
+	int col = encoder->col;
+
+	if(bestVertical == MOVE_CUD)
+		putMove(out, rows, 'B');
+
+	// \r\n works the same whether or not the tty adds a \r to each \n
+	if(bestVertical == MOVE_NEWLINE)
+	{
+		for(int i = 0; i < rows; i++)
+			putBytes(out, "\r\n", 2);
+		col = 0;
+	}
+
+	if(bestVertical == MOVE_CNL)
+	{
+		putMove(out, rows, 'E');
+		col = 0;
+	}
+
+	if(bestHorizontal == MOVE_CUF)
+		putMove(out, COL - col, 'C');
+
+	if(bestHorizontal == MOVE_CUB)
+		putMove(out, col - COL, 'D');
+
+	if(bestHorizontal == MOVE_CR)
+	{
+		putChar(out, '\r');
+		if(COL > 0) putMove(out, COL, 'C');
+	}
+
+	return(best);
+}
+
+// 1 if cell row ROW of IMAGE hashes the same as row PREV_ROW on screen
+int sameCellRow(
+	const Encoder *ENCODER, const Image IMAGE, const int ROW, const int PREV_ROW
+)
+{
+	return(
+		IMAGE.hashes[2 * ROW] == ENCODER->hashes[2 * PREV_ROW] &&
+		IMAGE.hashes[2 * ROW + 1] == ENCODER->hashes[2 * PREV_ROW + 1]
+	);
+}
+
+// looks for a band of cell rows that moved up (shift > 0) or down (shift < 0)
+// since the last frame, by comparing row hashes. Returns how many rows less
+// have to be redrawn if the terminal scrolls the rows from top to bottom (the
+// rows the band leaves blank have to be drawn), 0 if no band helps.
+int findScroll(
+	Encoder *encoder, const Image IMAGE, int *shift, int *top, int *bottom
+)
+{
+	int rows = IMAGE.height / 2;
+	int *changed = encoder->changedRows;
+
+	changed[0] = 0;
+	for(int r = 0; r < rows; r++)
+		changed[r + 1] = changed[r] + (sameCellRow(encoder, IMAGE, r, r) == 0);
+
+	if(changed[rows] < SCROLL_MIN_GAIN)
+		return(0);
+
+	int best = 0;
+
+	// new row r shows what was on row r + s
+	for(int s = 1 - rows; s < rows; s++)
+	{
+		if(s == 0)
+			continue;
+
+		int k = s > 0 ? s : -s;
+		int from = s > 0 ? 0 : k;
+		int to = s > 0 ? rows - k : rows;
+
+		for(int r = from; r < to; r++)
+		{
+			if(sameCellRow(encoder, IMAGE, r, r + s) == 0)
+				continue;
+
+			int start = r;
+			while(r + 1 < to && sameCellRow(encoder, IMAGE, r + 1, r + 1 + s))
+				r++;
+
+			// the band plus the k rows it scrolls away from
+			int first = s > 0 ? start : start - k;
+			int last = s > 0 ? r + k : r;
+			int gain = changed[last + 1] - changed[first] - k;
+
+			if(gain > best)
+			{
+				best = gain;
+				*shift = s;
+				*top = first;
+				*bottom = last;
+			}
+		}
+	}
+
+	return(best);
+}
+
+// moves COUNT cell rows of what the encoder knows about the screen from FROM
+// to TO (prevImage, row hashes and drift)
+void moveCellRows(
+	Encoder *encoder, Image prevImage,
+	const int FROM, const int TO, const int COUNT
+)
+{
+	long width = prevImage.width;
+
+	memmove(
+		prevImage.pixels + 2 * TO * width, prevImage.pixels + 2 * FROM * width,
+		2 * COUNT * width * sizeof(Pixel)
+	);
+
+	if(prevImage.glyphs != NULL)
+		memmove(
+			prevImage.glyphs + TO * width, prevImage.glyphs + FROM * width,
+			COUNT * width
+		);
+
+	memmove(
+		encoder->hashes + 2 * TO, encoder->hashes + 2 * FROM,
+		2 * COUNT * sizeof(uint64_t)
+	);
+
+	memmove(
+		encoder->drift + TO * (long)encoder->width,
+		encoder->drift + FROM * (long)encoder->width,
+		COUNT * encoder->width * sizeof(int)
+	);
+}
+
+// scrolls cell rows TOP to BOTTOM by SHIFT rows (up if > 0) inside a scroll
+// region (DECSTBM + SU / SD) and returns the rows left blank in exposedFrom to
+// exposedTo (exclusive)
+void scrollRows(
+	Encoder *encoder, OutBuf *out, Image prevImage,
+	const int SHIFT, const int TOP, const int BOTTOM,
+	int *exposedFrom, int *exposedTo
+)
+{
+	int k = SHIFT > 0 ? SHIFT : -SHIFT;
+	int kept = BOTTOM - TOP + 1 - k;
+
+	// the blank rows get the current background, which has to be the default
+	// one in the column that is never drawn
+	putString(out, "\x1b[0m\x1b[");
+	putInt(out, TOP + 1);
+	putChar(out, ';');
+	putInt(out, BOTTOM + 1);
+	putChar(out, 'r');
+
+	putBytes(out, "\x1b[", 2);
+	if(k > 1) putInt(out, k);
+	putChar(out, SHIFT > 0 ? 'S' : 'T');
+
+	// full screen again, this also moves the cursor to the top left. The
+	// colors were reset above, so they are unknown too.
+	putString(out, "\x1b[r");
+	encoder->row = -1;
+	encoder->col = -1;
+	encoder->fgSet = 0;
+	encoder->bgSet = 0;
+
+	if(SHIFT > 0)
+	{
+		moveCellRows(encoder, prevImage, TOP + k, TOP, kept);
+		*exposedFrom = TOP + kept;
+	}
+	else
+	{
+		moveCellRows(encoder, prevImage, TOP, TOP + k, kept);
+		*exposedFrom = TOP;
+	}
+
+	*exposedTo = *exposedFrom + k;
+}
+
+// encodes the changed cells of cell rows FROM to TO (exclusive) of the
+// current job (see updateScreen())
+void encodeRows(Encoder *encoder, OutBuf *out, const int FROM, const int TO)
+{
+	Image image = encoder->image;
+	Image prevImage = encoder->prevImage;
+
+	// the last column is never drawn
+	int width = image.width - 1;
+	uint64_t *mask = encoder->mask;
+
+	int useHashes = encoder->useHashes;
+
+	for(int row = FROM; row < TO; row++)
+	{
+		int i = row * 2; // update 2 pixels at once
+		int exposed = row >= encoder->exposedFrom && row < encoder->exposedTo;
+
+		encoder->heldRows[row] = 0;
+
+		// rows that hash the same as the ones on screen are skipped without
+		// looking at the pixels
+		if(
+			useHashes == 1 &&
+			exposed == 0 &&
+			image.hashes[i] == encoder->hashes[i] &&
+			image.hashes[i + 1] == encoder->hashes[i + 1]
+		)
+			continue;
+
+		Pixel *top = image.pixels + i * image.width;
+		Pixel *bottom = top + image.width;
+		Pixel *prevTop = prevImage.pixels + i * prevImage.width;
+		Pixel *prevBottom = prevTop + prevImage.width;
+
+		unsigned char *glyphs = NULL;
+		unsigned char *prevGlyphs = NULL;
+
+		if(image.glyphs != NULL)
+		{
+			glyphs = image.glyphs + row * image.width;
+			prevGlyphs = prevImage.glyphs + row * prevImage.width;
+		}
+
+		if(encoder->redraw == 1 || exposed == 1)
+		{
+			memset(mask, 0xff, (width + 63) / 64 * sizeof(uint64_t));
+		}
+		else
+		{
+			int changed
+				= encoder->diffRow(top, bottom, prevTop, prevBottom, width, mask);
+
+			if(glyphs != NULL)
+				changed |= diffGlyphs(glyphs, prevGlyphs, width, mask);
+
+			if(changed == 0)
+				continue;
+
+			if(
+				encoder->threshold > 0 &&
+				filterChanges(
+					encoder, row, top, bottom, prevTop, prevBottom,
+					glyphs, prevGlyphs, width, mask
+				) == 0
+			)
+				continue;
+		}
+
+		#define changedCell(j) ((mask[(j) / 64] >> ((j) % 64)) & 1)
+		#define glyphAt(j) (glyphs != NULL ? glyphs[j] : 0)
+
+		for(int j = 0; j < width; j++)
+		{
+			// jump to the next changed cell
+			uint64_t bits = mask[j / 64] >> (j % 64);
+			if(bits == 0)
+			{
+				j = (j / 64) * 64 + 63;
+				continue;
+			}
+			j += __builtin_ctzll(bits);
+			if(j >= width)
+				break;
+
+			// changed cells right after this one that look the same
+			int run = 1;
+			while(
+				j + run < width &&
+				changedCell(j + run) &&
+				samePixel(top[j + run], top[j]) &&
+				samePixel(bottom[j + run], bottom[j]) &&
+				glyphAt(j + run) == glyphAt(j)
+			)
+				run++;
+
+			reserveOutBuf(out, MAX_CELL_BYTES);
+
+			if(encoder->row != row || encoder->col != j)
+			{
+				int moveCost = moveCursor(encoder, NULL, row, j);
+				int redrawn = 0;
+
+				// redrawing a few unchanged cells can be shorter than moving
+				// over them
+				if(encoder->row == row && encoder->col < j)
+				{
+					int gap = j - encoder->col;
+
+					if(gap < moveCost)
+					{
+						Encoder saved = *encoder;
+						int savedSize = out->size;
+
+						int from = encoder->col;
+						for(int k = from; k < j; k++)
+							putCell(
+								encoder, out, top[k], bottom[k], glyphAt(k)
+							);
+
+						if(out->size - savedSize < moveCost)
+						{
+							redrawn = 1;
+							drawnCells(
+								encoder, row, from, j - from,
+								prevTop, prevBottom, prevGlyphs,
+								top, bottom, glyphs
+							);
+						}
+						else
+						{
+							*encoder = saved;
+							out->size = savedSize;
+						}
+					}
+				}
+
+				if(redrawn == 0)
+					moveCursor(encoder, out, row, j);
+			}
+
+			const char *glyph
+				= putCell(encoder, out, top[j], bottom[j], glyphAt(j));
+			if(run > 1)
+				putRepeat(encoder, out, glyph, run - 1);
+
+			drawnCells(
+				encoder, row, j, run,
+				prevTop, prevBottom, prevGlyphs, top, bottom, glyphs
+			);
+
+			encoder->row = row;
+			encoder->col = j + run;
+			j += run - 1;
+		}
+	}
+}
+
+void encodeBand(void *arg, int index)
+{
+	Encoder *encoder = (Encoder*)arg;
+	EncoderBand *band = encoder->bands + index;
+
+	encodeRows(&band->encoder, &band->out, band->from, band->to);
+}
+
+// only updates changed cells (2 pixels each, one above the other, or two
+// colors and a glyph), prevImage is what is on screen and is updated to match
+// image
+void updateScreen(Encoder *encoder, OutBuf *out, Image image, Image prevImage)
+{
+	//Hide cursor (avoids that one white pixel when playing video)
+	putString(out, "\033[?25l");
+
+	// whatever was drawn since the last frame (progress bar) may have changed
+	// the colors
+	encoder->fgSet = 0;
+	encoder->bgSet = 0;
+	encoder->row = -1;
+	encoder->col = -1;
+
+	// ascii is drawn in the default colors
+	if(encoder->glyphs != NULL && encoder->glyphs->colored == 0)
+		putString(out, "\x1b[0m");
+
+	encoder->image = image;
+	encoder->prevImage = prevImage;
+	encoder->useHashes = encoder->redraw == 0
+		&& image.hashes != NULL
+		&& encoder->hashCount == image.height;
+
+	// content that moved up or down is scrolled on the terminal, only the
+	// rows that leaves blank (and whatever else changed) are drawn
+	encoder->exposedFrom = 0;
+	encoder->exposedTo = 0;
+
+	if(encoder->useHashes == 1 && encoder->scroll == 1)
+	{
+		int shift, top, bottom;
+		if(findScroll(encoder, image, &shift, &top, &bottom) >= SCROLL_MIN_GAIN)
+			scrollRows(
+				encoder, out, prevImage, shift, top, bottom,
+				&encoder->exposedFrom, &encoder->exposedTo
+			);
+	}
+
+	int rows = image.height / 2;
+	int bands = 1;
+
+	if(encoder->workers != NULL)
+	{
+		bands = encoder->workers->count;
+
+		long cells = (long)rows * image.width;
+		if(bands > cells / ENCODE_BAND_CELLS)
+			bands = max(1, cells / ENCODE_BAND_CELLS);
+	}
+
+	if(bands == 1)
+		encodeRows(encoder, out, 0, rows);
+	else
+	{
+		// every worker gets called, the ones without a band get no rows
+		for(int i = 0; i < encoder->workers->count; i++)
+		{
+			EncoderBand *band = encoder->bands + i;
+
+			band->encoder = *encoder;
+			band->encoder.mask = band->mask;
+			band->from = i < bands ? rows * i / bands : rows;
+			band->to = i < bands ? rows * (i + 1) / bands : rows;
+			band->out.size = 0;
+		}
+
+		runWorkers(encoder->workers, encodeBand, encoder);
+
+		// the bands in order, still one buffer for one write
+		for(int i = 0; i < bands; i++)
+		{
+			EncoderBand *band = encoder->bands + i;
+			putBytes(out, band->out.data, band->out.size);
+
+			if(band->out.size > 0)
+			{
+				encoder->fg = band->encoder.fg;
+				encoder->bg = band->encoder.bg;
+				encoder->fgSet = band->encoder.fgSet;
+				encoder->bgSet = band->encoder.bgSet;
+				encoder->row = band->encoder.row;
+				encoder->col = band->encoder.col;
+			}
+		}
+	}
+
+	if(image.hashes != NULL)
+	{
+		memcpy(encoder->hashes, image.hashes, image.height * sizeof(uint64_t));
+		encoder->hashCount = image.height;
+
+		// rows with cells held back by -d are diffed again in the next frame,
+		// so the drift can add up until they are drawn
+		for(int row = 0; row < rows; row++)
+			if(encoder->heldRows[row] == 1)
+			{
+				encoder->hashes[2 * row] = ~image.hashes[2 * row];
+				encoder->hashes[2 * row + 1] = ~image.hashes[2 * row + 1];
+			}
+	}
+	else
+		encoder->hashCount = 0;
+
+	encoder->redraw = 0;
+}
+
+//-------- sixel -------------------------------------------------------------//
+
+// draws real pixels instead of cells (xterm -ti vt340, mlterm, foot). Every
+// frame gets its own palette from a median cut of a 5 bit per channel
+// histogram and is sent in full, unless it is the same as the one on screen.
+
+#define SIXEL_COLORS 256
+
+// a box of histogram bins (Sixel.entries FROM to TO) for the median cut
+typedef struct Box
+{
+	int from;
+	int to;
+	long count; // pixels in the box
+	unsigned char low[3];
+	unsigned char high[3];
+}Box;
+
+typedef struct Sixel
+{
+	int width;
+	int height;
+	int colors;
+	Pixel palette[SIXEL_COLORS];
+
+	unsigned int *histogram; // pixels for every 5 bit r, g, b
+	unsigned short *entries; // bins that are used
+	unsigned short *sorted; // scratch for sorting entries
+	unsigned char *lut; // palette index of every used bin
+	unsigned char *indices; // palette index of every pixel
+
+	// sixels of every color in the current band and the columns they use
+	// (-1 = not in the band)
+	unsigned char *bits;
+	int first[SIXEL_COLORS];
+	int last[SIXEL_COLORS];
+
+	uint64_t hash; // of the frame on screen
+	int drawn;
+}Sixel;
+
+void initSixel(Sixel *sixel, const int WIDTH, const int HEIGHT)
+{
+	sixel->width = WIDTH;
+	sixel->height = HEIGHT;
+	sixel->colors = 0;
+	sixel->drawn = 0;
+
+	sixel->histogram = malloc(32 * 32 * 32 * sizeof(unsigned int));
+	sixel->entries = malloc(32 * 32 * 32 * sizeof(unsigned short));
+	sixel->sorted = malloc(32 * 32 * 32 * sizeof(unsigned short));
+	sixel->lut = malloc(32 * 32 * 32);
+	sixel->indices = malloc((long)WIDTH * HEIGHT);
+	sixel->bits = calloc((long)SIXEL_COLORS * WIDTH, 1);
+
+	if(
+		sixel->histogram == NULL ||
+		sixel->entries == NULL ||
+		sixel->sorted == NULL ||
+		sixel->lut == NULL ||
+		sixel->indices == NULL ||
+		sixel->bits == NULL
+	)
+		error("failed to allocate memory for sixel");
+
+	for(int i = 0; i < SIXEL_COLORS; i++)
+		sixel->first[i] = -1;
+}
+
+void freeSixel(Sixel *sixel)
+{
+	free(sixel->histogram);
+	free(sixel->entries);
+	free(sixel->sorted);
+	free(sixel->lut);
+	free(sixel->indices);
+	free(sixel->bits);
+	sixel->histogram = NULL;
+	sixel->entries = NULL;
+	sixel->sorted = NULL;
+	sixel->lut = NULL;
+	sixel->indices = NULL;
+	sixel->bits = NULL;
+}
+
+//-------- sixel palette -----------------------------------------------------//
+
+int binValue(const int BIN, const int CHANNEL)
+{
+	return(BIN >> (10 - CHANNEL * 5) & 31);
+}
+
+// recomputes the pixel count and the bounds of BOX
+void shrinkBox(Sixel *sixel, Box *box)
+{
+	box->count = 0;
+
+	for(int c = 0; c < 3; c++)
+	{
+		box->low[c] = 31;
+		box->high[c] = 0;
+	}
+
+	for(int i = box->from; i < box->to; i++)
+	{
+		int bin = sixel->entries[i];
+		box->count += sixel->histogram[bin];
+
+		for(int c = 0; c < 3; c++)
+		{
+			int value = binValue(bin, c);
+			if(value < box->low[c]) box->low[c] = value;
+			if(value > box->high[c]) box->high[c] = value;
+		}
+	}
+}
+
+// sorts the bins of BOX by CHANNEL (counting sort, there are only 32 values)
+void sortBox(Sixel *sixel, const Box *BOX, const int CHANNEL)
+{
+	int start[33] = {0};
+
+	for(int i = BOX->from; i < BOX->to; i++)
+		start[binValue(sixel->entries[i], CHANNEL) + 1]++;
+
+	for(int i = 1; i <= 32; i++)
+		start[i] += start[i - 1];
+
+	for(int i = BOX->from; i < BOX->to; i++)
+	{
+		int bin = sixel->entries[i];
+		sixel->sorted[start[binValue(bin, CHANNEL)]++] = bin;
+	}
+
+	memcpy(
+		sixel->entries + BOX->from, sixel->sorted,
+		(BOX->to - BOX->from) * sizeof(unsigned short)
+	);
+}
+
+void buildSixelPalette(Sixel *sixel, const Image IMAGE)
+{
+	memset(sixel->histogram, 0, 32 * 32 * 32 * sizeof(unsigned int));
+
+	// every pixel is counted (that is cheap), so every color of the frame
+	// ends up in a box and has a palette index
+	for(long i = 0; i < (long)IMAGE.width * IMAGE.height; i++)
+	{
+		Pixel pixel = IMAGE.pixels[i];
+		sixel->histogram[
+			(pixel.r >> 3) << 10 | (pixel.g >> 3) << 5 | pixel.b >> 3
+		]++;
+	}
+
+	int count = 0;
+	for(int bin = 0; bin < 32 * 32 * 32; bin++)
+		if(sixel->histogram[bin] > 0)
+			sixel->entries[count++] = bin;
+
+	Box boxes[SIXEL_COLORS];
+	boxes[0].from = 0;
+	boxes[0].to = count;
+	shrinkBox(sixel, &boxes[0]);
+	int boxCount = 1;
+
+	while(boxCount < SIXEL_COLORS)
+	{
+		// split the box with the longest side (weighted by its pixels)
+		int best = -1;
+		int bestChannel = 0;
+		long bestScore = 0;
+
+		for(int i = 0; i < boxCount; i++)
+		{
+			if(boxes[i].to - boxes[i].from < 2)
+				continue;
+
+			for(int c = 0; c < 3; c++)
+			{
+				long score = (boxes[i].high[c] - boxes[i].low[c]) * boxes[i].count;
+				if(score > bestScore)
+				{
+					best = i;
+					bestChannel = c;
+					bestScore = score;
+				}
+			}
+		}
+
+		if(best == -1)
+			break;
+
+		Box *box = &boxes[best];
+		sortBox(sixel, box, bestChannel);
+
+		// split where half of the pixels are on each side
+		long half = 0;
+		int split = box->from + 1;
+
+		for(int i = box->from; i < box->to - 1; i++)
+		{
+			half += sixel->histogram[sixel->entries[i]];
+			split = i + 1;
+			if(half * 2 >= box->count) break;
+		}
+
+		boxes[boxCount].from = split;
+		boxes[boxCount].to = box->to;
+		box->to = split;
+		shrinkBox(sixel, box);
+		shrinkBox(sixel, &boxes[boxCount]);
+		boxCount++;
+	}
+
+	for(int i = 0; i < boxCount; i++)
+	{
+		long sum[3] = {0};
+
+		for(int j = boxes[i].from; j < boxes[i].to; j++)
+		{
+			int bin = sixel->entries[j];
+			for(int c = 0; c < 3; c++)
+				sum[c] += (long)(binValue(bin, c) << 3 | 4) * sixel->histogram[bin];
+			sixel->lut[bin] = i;
+		}
+
+		long pixels = max(1, boxes[i].count);
+		sixel->palette[i] = (Pixel){
+			sum[0] / pixels, sum[1] / pixels, sum[2] / pixels, 0
+		};
+	}
+
+	sixel->colors = boxCount;
+}
+
+void indexSixelPixels(Sixel *sixel, const Image IMAGE)
+{
+	for(long i = 0; i < (long)IMAGE.width * IMAGE.height; i++)
+	{
+		Pixel pixel = IMAGE.pixels[i];
+		sixel->indices[i] = sixel->lut[
+			(pixel.r >> 3) << 10 | (pixel.g >> 3) << 5 | pixel.b >> 3
+		];
+	}
+}
+
+//-------- sixel encoding ----------------------------------------------------//
+
+// COUNT times the same sixel, with the repeat introducer when that is shorter
+void putSixelRun(OutBuf *out, const char SIXEL, const int COUNT)
+{
+	if(COUNT > 3)
+	{
+		putChar(out, '!');
+		putInt(out, COUNT);
+		putChar(out, SIXEL);
+	}
+	else
+		for(int i = 0; i < COUNT; i++)
+			putChar(out, SIXEL);
+}
+
+// draws IMAGE at the cursor. Returns 0 if it was skipped because it is the
+// frame that is already on screen.
+int putSixel(Sixel *sixel, OutBuf *out, const Image IMAGE)
+{
+	uint64_t hash = hashImage(IMAGE);
+
+	if(sixel->drawn == 1 && hash == sixel->hash)
+		return(0);
+
+	sixel->hash = hash;
+	sixel->drawn = 1;
+
+	buildSixelPalette(sixel, IMAGE);
+	indexSixelPixels(sixel, IMAGE);
+
+	int width = IMAGE.width;
+
+	// P2 = 1: pixels that aren't set keep their color. Square pixels.
+	putString(out, "\x1bP0;1q\"1;1;");
+	putInt(out, width);
+	putChar(out, ';');
+	putInt(out, IMAGE.height);
+
+	for(int i = 0; i < sixel->colors; i++)
+	{
+		putChar(out, '#');
+		putInt(out, i);
+		putString(out, ";2;");
+		putInt(out, (sixel->palette[i].r * 100 + 127) / 255);
+		putChar(out, ';');
+		putInt(out, (sixel->palette[i].g * 100 + 127) / 255);
+		putChar(out, ';');
+		putInt(out, (sixel->palette[i].b * 100 + 127) / 255);
+	}
+
+	// bands of 6 rows, one pass per color that is used in the band
+	for(int y = 0; y < IMAGE.height; y += 6)
+	{
+		int rows = min(6, IMAGE.height - y);
+		int used[SIXEL_COLORS];
+		int usedCount = 0;
+
+		for(int r = 0; r < rows; r++)
+		{
+			const unsigned char *indices = sixel->indices + (long)(y + r) * width;
+
+			for(int x = 0; x < width; x++)
+			{
+				int color = indices[x];
+
+				if(sixel->first[color] == -1)
+				{
+					sixel->first[color] = x;
+					sixel->last[color] = x;
+					used[usedCount++] = color;
+				}
+				else
+				{
+					if(x < sixel->first[color]) sixel->first[color] = x;
+					if(x > sixel->last[color]) sixel->last[color] = x;
+				}
+
+				sixel->bits[(long)color * width + x] |= 1 << r;
+			}
+		}
+
+		for(int i = 0; i < usedCount; i++)
+		{
+			int color = used[i];
+			unsigned char *bits = sixel->bits + (long)color * width;
+
+			// back to the start of the band for every color but the first
+			if(i > 0) putChar(out, '$');
+			putChar(out, '#');
+			putInt(out, color);
+
+			putSixelRun(out, '?', sixel->first[color]);
+
+			int x = sixel->first[color];
+			while(x <= sixel->last[color])
+			{
+				int run = 1;
+
+				// columns without this color, 8 at a time
+				if(bits[x] == 0)
+				{
+					uint64_t word;
+					while(
+						x + run + 8 <= sixel->last[color] &&
+						(memcpy(&word, bits + x + run, 8), word == 0)
+					)
+						run += 8;
+				}
+
+				while(x + run <= sixel->last[color] && bits[x + run] == bits[x])
+					run++;
+
+				putSixelRun(out, '?' + bits[x], run);
+				memset(bits + x, 0, run);
+				x += run;
+			}
+
+			sixel->first[color] = -1;
+		}
+
+		putChar(out, '-');
+	}
+
+	putString(out, "\x1b\\");
+	return(1);
+}
+
+//-------- kitty -------------------------------------------------------------//
+
+// kitty graphics protocol: frames are sent as raw rgb and replace the image
+// with the same id, so the terminal only keeps the newest one. The pixels go
+// through a POSIX shared memory object if the terminal can open it (it runs on
+// this machine), otherwise they are zlib compressed and base64 encoded.
+
+#define KITTY_ID 1
+#define KITTY_CHUNK 4096 // max base64 bytes per escape sequence
+
+// frames go through this many shared memory objects in turn. The terminal
+// removes an object once it has read it. One it never read (it rejected the
+// frame, or q=2 hid an error) is removed when its name comes round again,
+// and cleanup() removes whatever is left.
+#define KITTY_SHM_OBJECTS 16
+
+typedef struct Kitty
+{
+	int width;
+	int height;
+	int shm; // the terminal reads shared memory objects
+	int objects; // shared memory objects created (see kittyShmName())
+
+	unsigned char *rgb; // the frame without the padding byte
+	unsigned char *packed; // rgb compressed
+	unsigned long packedCapacity;
+
+	uint64_t hash; // of the frame on screen
+	int drawn;
+}Kitty;
+
+const char BASE64[]
+	= "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// writes SIZE bytes of DATA to dest as base64, returns the length
+long encodeBase64(char *dest, const unsigned char *DATA, const long SIZE)
+{
+	long length = 0;
+
+	for(long i = 0; i < SIZE; i += 3)
+	{
+		unsigned int value = DATA[i] << 16;
+		if(i + 1 < SIZE) value |= DATA[i + 1] << 8;
+		if(i + 2 < SIZE) value |= DATA[i + 2];
+
+		dest[length++] = BASE64[value >> 18];
+		dest[length++] = BASE64[value >> 12 & 63];
+		dest[length++] = i + 1 < SIZE ? BASE64[value >> 6 & 63] : '=';
+		dest[length++] = i + 2 < SIZE ? BASE64[value & 63] : '=';
+	}
+
+	return(length);
+}
+
+void putBase64(OutBuf *out, const unsigned char *DATA, const long SIZE)
+{
+	reserveOutBuf(out, (SIZE + 2) / 3 * 4);
+	out->size += encodeBase64(out->data + out->size, DATA, SIZE);
+}
+
+// creates the shared memory object NAME with SIZE bytes and maps it. Returns
+// NULL if that isn't possible (no /dev/shm, name already taken).
+unsigned char *createShm(const char *NAME, const long SIZE)
+{
+	int fd = shm_open(NAME, O_CREAT | O_EXCL | O_RDWR, 0600);
+	if(fd == -1)
+		return(NULL);
+
+	void *data = MAP_FAILED;
+	if(ftruncate(fd, SIZE) == 0)
+		data = mmap(NULL, SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if(data == MAP_FAILED)
+	{
+		shm_unlink(NAME);
+		return(NULL);
+	}
+
+	return(data);
+}
+
+// name of the INDEX-th shared memory object for frames
+void kittyShmName(char *name, const int SIZE, const int INDEX)
+{
+	snprintf(name, SIZE, "/tmv-%d-%d", getpid(), INDEX % KITTY_SHM_OBJECTS);
+}
+
+// asks the terminal to load a 1 * 1 image from shared memory. Only a terminal
+// on this machine can (not one at the other end of ssh), and only kitty
+// compatible ones answer at all.
+int probeKittyShm()
+{
+	char name[64];
+	snprintf(name, sizeof(name), "/tmv-%d-probe", getpid());
+
+	unsigned char *rgb = createShm(name, 3);
+	if(rgb == NULL)
+		return(0);
+
+	memset(rgb, 0, 3);
+	munmap(rgb, 3);
+
+	char query[128] = "\033_Gi=31,s=1,v=1,a=q,t=s,f=24;";
+	int length = strlen(query);
+	length += encodeBase64(
+		query + length, (const unsigned char*)name, strlen(name)
+	);
+	strcpy(query + length, "\033\\");
+
+	char reply[256];
+	queryTerminal(query, reply, sizeof(reply));
+
+	// the terminal removes the object once it has read it
+	shm_unlink(name);
+
+	return(strstr(reply, "\033_Gi=31;OK") != NULL);
+}
+
+void initKitty(Kitty *kitty, const int WIDTH, const int HEIGHT, const int SHM)
+{
+	kitty->width = WIDTH;
+	kitty->height = HEIGHT;
+	kitty->shm = SHM;
+	kitty->objects = 0;
+	kitty->drawn = 0;
+
+	long size = (long)WIDTH * HEIGHT * 3;
+	kitty->packedCapacity = compressBound(size);
+	kitty->rgb = malloc(size);
+	kitty->packed = malloc(kitty->packedCapacity);
+
+	if(kitty->rgb == NULL || kitty->packed == NULL)
+		error("failed to allocate memory for kitty");
+}
+
+void freeKitty(Kitty *kitty)
+{
+	free(kitty->rgb);
+	free(kitty->packed);
+	kitty->rgb = NULL;
+	kitty->packed = NULL;
+}
+
+// IMAGE to rgb (3 bytes per pixel)
+void packRGB(unsigned char *rgb, const Image IMAGE)
+{
+	for(long i = 0; i < (long)IMAGE.width * IMAGE.height; i++)
+	{
+		rgb[i * 3] = IMAGE.pixels[i].r;
+		rgb[i * 3 + 1] = IMAGE.pixels[i].g;
+		rgb[i * 3 + 2] = IMAGE.pixels[i].b;
+	}
+}
+
+// draws IMAGE at the cursor in place of the last frame (the cursor doesn't
+// move). Returns 0 if it was skipped because it is the frame that is already
+// on screen.
+int putKitty(Kitty *kitty, OutBuf *out, const Image IMAGE)
+{
+	uint64_t hash = hashImage(IMAGE);
+
+	if(kitty->drawn == 1 && hash == kitty->hash)
+		return(0);
+
+	kitty->hash = hash;
+	kitty->drawn = 1;
+
+	long size = (long)IMAGE.width * IMAGE.height * 3;
+
+	// q=2: no answers from the terminal, C=1: the cursor stays where it is
+	putString(out, "\033_Ga=T,f=24,q=2,C=1,i=");
+	putInt(out, KITTY_ID);
+	putString(out, ",p=");
+	putInt(out, KITTY_ID);
+	putString(out, ",s=");
+	putInt(out, IMAGE.width);
+	putString(out, ",v=");
+	putInt(out, IMAGE.height);
+
+	if(kitty->shm == 1)
+	{
+		char name[64];
+		kittyShmName(name, sizeof(name), kitty->objects++);
+
+		// still there if the terminal never read that frame
+		shm_unlink(name);
+
+		unsigned char *rgb = createShm(name, size);
+		if(rgb != NULL)
+		{
+			packRGB(rgb, IMAGE);
+			munmap(rgb, size);
+
+			// only the name goes through the tty
+			putString(out, ",t=s;");
+			putBase64(out, (const unsigned char*)name, strlen(name));
+			putString(out, "\033\\");
+			return(1);
+		}
+
+		// e.g. /dev/shm is full, this and every later frame go the slow way
+		kitty->shm = 0;
+	}
+
+	packRGB(kitty->rgb, IMAGE);
+
+	uLongf packedSize = kitty->packedCapacity;
+	if(
+		compress2(kitty->packed, &packedSize, kitty->rgb, size, Z_BEST_SPEED)
+			!= Z_OK
+	)
+		error("failed to compress frame");
+
+	putString(out, ",o=z");
+
+	// every chunk but the last has m=1, only the first has the other keys
+	const long CHUNK = KITTY_CHUNK / 4 * 3;
+	for(long i = 0; i < (long)packedSize; i += CHUNK)
+	{
+		putString(out, i == 0 ? "," : "\033_Gq=2,");
+		putString(out, i + CHUNK < (long)packedSize ? "m=1;" : "m=0;");
+		putBase64(out, kitty->packed + i, min(CHUNK, (long)packedSize - i));
+		putString(out, "\033\\");
+	}
+
+	return(1);
+}
+
+//-------- benchmark ---------------------------------------------------------//
+
+// the old printf() based encoder, only kept as a baseline for -b (FULL = 1
+// draws every cell)
+int printfUpdateScreen(
+	FILE *file, Image image, Image prevImage, const int FULL
+)
+{
+	#define cPixel1 image.pixels[i * image.width + j]
+	#define cPixel2 image.pixels[(i + 1) * image.width + j]
+	#define pPixel1 prevImage.pixels[i * prevImage.width + j]
+	#define pPixel2 prevImage.pixels[(i + 1) * prevImage.width + j]
+
+	int bytes = fprintf(file, "\033[?25l");
+
+	for(int i = 0; i < image.height - 1; i += 2)
+	{
+		for(int j = 0; j < image.width - 1; j++)
+		{
+			if(
+				FULL == 1 ||
+				cPixel1.r != pPixel1.r ||
+				cPixel1.g != pPixel1.g ||
+				cPixel1.b != pPixel1.b ||
+				cPixel2.r != pPixel2.r ||
+				cPixel2.g != pPixel2.g ||
+				cPixel2.b != pPixel2.b
+			)
+			{
+				bytes += fprintf(file, "\033[%d;%dH", i / 2 + 1, j + 1);
+				bytes += fprintf(
+					file, "\x1b[48;2;%d;%d;%dm", cPixel1.r, cPixel1.g, cPixel1.b
+				);
+				bytes += fprintf(
+					file, "\x1b[38;2;%d;%d;%dm", cPixel2.r, cPixel2.g, cPixel2.b
+				);
+				bytes += fprintf(file, "▄");
+			}
+		}
+	}
+
+	fflush(file);
+	return(bytes);
+}
+
+// runs both encoders on the same frames (output goes to /dev/null) and
+// measures how long they take and how much they write
+typedef struct Bench
+{
+	FILE *file;
+	int fd;
+	OutBuf out;
+	Encoder encoder;
+	Workers workers; // for the encoder if threads > 1
+	int threads;
+	Image prevImage;
+	int full; // next frame is drawn in full
+
+	// if threads > 1, the same frames also go through a single threaded
+	// encoder (with its own screen), so the speedup can be measured
+	Encoder single;
+	Image singleImage;
+
+	long frames;
+	long cells; // cells per frame
+	long changed; // changed cells over all frames
+
+	long printfBytes;
+	int64_t printfTime;
+	long encoderBytes;
+	int64_t encoderTime;
+	int64_t singleTime;
+
+	int graphics; // Graphics (graphics only measure their own encoder)
+	Sixel sixel;
+	Kitty kitty; // never uses shared memory (nobody reads the objects)
+}Bench;
+
+void initBench(
+	Bench *bench, const int WIDTH, const int HEIGHT, const Settings SETTINGS
+)
+{
+	bench->file = fopen("/dev/null", "w");
+	bench->fd = open("/dev/null", O_WRONLY);
+
+	if(bench->file == NULL || bench->fd == -1)
+		error("could not open /dev/null");
+
+	initOutBuf(&bench->out, WIDTH * HEIGHT / 2 * MAX_CELL_BYTES + 64);
+	initEncoder(&bench->encoder, WIDTH, HEIGHT, SETTINGS);
+
+	bench->threads = SETTINGS.graphics == GRAPHICS_CELLS
+		? encodeThreads(WIDTH, HEIGHT, SETTINGS.threads) : 1;
+
+	if(bench->threads > 1)
+	{
+		startWorkers(&bench->workers, bench->threads);
+		shareEncoder(&bench->encoder, &bench->workers);
+		initEncoder(&bench->single, WIDTH, HEIGHT, SETTINGS);
+	}
+
+	bench->prevImage.width = WIDTH;
+	bench->prevImage.height = HEIGHT;
+	bench->prevImage.pixels = malloc(WIDTH * HEIGHT * sizeof(Pixel));
+	bench->prevImage.hashes = NULL;
+	bench->prevImage.glyphs = NULL;
+	bench->full = 1;
+
+	if(bench->prevImage.pixels == NULL)
+		error("failed to allocate memory for prevImage");
+
+	if(SETTINGS.mode != MODE_HALF)
+		allocGlyphs(&bench->prevImage);
+
+	if(bench->threads > 1)
+	{
+		bench->singleImage = bench->prevImage;
+		bench->singleImage.pixels = malloc(WIDTH * HEIGHT * sizeof(Pixel));
+		bench->singleImage.glyphs = NULL;
+
+		if(bench->singleImage.pixels == NULL)
+			error("failed to allocate memory for prevImage");
+
+		if(SETTINGS.mode != MODE_HALF)
+			allocGlyphs(&bench->singleImage);
+	}
+
+	bench->frames = 0;
+	bench->cells = (long)(WIDTH - 1) * (HEIGHT / 2);
+	bench->changed = 0;
+	bench->printfBytes = 0;
+	bench->printfTime = 0;
+	bench->encoderBytes = 0;
+	bench->encoderTime = 0;
+	bench->singleTime = 0;
+
+	bench->graphics = SETTINGS.graphics;
+	if(bench->graphics == GRAPHICS_SIXEL)
+	{
+		initSixel(&bench->sixel, WIDTH, HEIGHT);
+		bench->cells = (long)WIDTH * HEIGHT;
+	}
+	else if(bench->graphics == GRAPHICS_KITTY)
+	{
+		initKitty(&bench->kitty, WIDTH, HEIGHT, 0);
+		bench->cells = (long)WIDTH * HEIGHT;
+	}
+}
+
+void benchFrame(Bench *bench, Image image)
+{
+	if(bench->graphics != GRAPHICS_CELLS)
+	{
+		if(bench->full == 1)
+		{
+			bench->sixel.drawn = 0;
+			bench->kitty.drawn = 0;
+		}
+
+		int64_t start = getTime();
+		bench->changed += (
+			bench->graphics == GRAPHICS_SIXEL
+				? putSixel(&bench->sixel, &bench->out, image)
+				: putKitty(&bench->kitty, &bench->out, image)
+		) * bench->cells;
+		bench->encoderBytes += flushOutBuf(&bench->out, bench->fd);
+		bench->encoderTime += getTime() - start;
+
+		bench->full = 0;
+		bench->frames++;
+		return;
+	}
+
+	Image prevImage = bench->prevImage;
+
+	for(int i = 0; i < image.height - 1; i += 2)
+		for(int j = 0; j < image.width - 1; j++)
+			if(
+				bench->full == 1 ||
+				cPixel1.r != pPixel1.r ||
+				cPixel1.g != pPixel1.g ||
+				cPixel1.b != pPixel1.b ||
+				cPixel2.r != pPixel2.r ||
+				cPixel2.g != pPixel2.g ||
+				cPixel2.b != pPixel2.b
+			)
+				bench->changed++;
+
+	int64_t start = getTime();
+	bench->printfBytes
+		+= printfUpdateScreen(bench->file, image, prevImage, bench->full);
+	bench->printfTime += getTime() - start;
+
+	// also brings prevImage up to date
+	if(bench->full == 1) bench->encoder.redraw = 1;
+	start = getTime();
+	updateScreen(&bench->encoder, &bench->out, image, prevImage);
+	bench->encoderBytes += flushOutBuf(&bench->out, bench->fd);
+	bench->encoderTime += getTime() - start;
+
+	if(bench->threads > 1)
+	{
+		if(bench->full == 1) bench->single.redraw = 1;
+		start = getTime();
+		updateScreen(&bench->single, &bench->out, image, bench->singleImage);
+		flushOutBuf(&bench->out, bench->fd);
+		bench->singleTime += getTime() - start;
+	}
+
+	bench->full = 0;
+	bench->frames++;
+}
+
+void printBench(Bench *bench)
+{
+	if(bench->frames == 0)
+		return;
+
+	long cells = bench->cells * bench->frames;
+
+	if(bench->graphics != GRAPHICS_CELLS)
+	{
+		printf(
+			"%ld frames, %ld pixels per frame, %.1f%% sent\n",
+			bench->frames, bench->cells, 100.0 * bench->changed / cells
+		);
+		printf(
+			"%s: %ld bytes/frame, %.1f ns/pixel\n",
+			bench->graphics == GRAPHICS_SIXEL ? "sixel" : "kitty",
+			bench->encoderBytes / bench->frames,
+			(double)bench->encoderTime / cells
+		);
+		return;
+	}
+
+	printf(
+		"%ld frames, %ld cells per frame, %.1f%% changed\n",
+		bench->frames, bench->cells, 100.0 * bench->changed / cells
+	);
+	printf(
+		"printf: %ld bytes/frame, %.1f ns/cell\n",
+		bench->printfBytes / bench->frames,
+		(double)bench->printfTime / cells
+	);
+	printf(
+		"encoder: %ld bytes/frame, %.1f ns/cell (%d thread%s)\n",
+		bench->encoderBytes / bench->frames,
+		(double)bench->encoderTime / cells,
+		bench->threads, bench->threads == 1 ? "" : "s"
+	);
+
+	if(bench->threads > 1)
+		printf(
+			"1 thread: %.1f ns/cell (%.2fx speedup)\n",
+			(double)bench->singleTime / cells,
+			(double)bench->singleTime / max(bench->encoderTime, 1)
+		);
+}
+
+void freeBench(Bench *bench)
+{
+	fclose(bench->file);
+	close(bench->fd);
+	freeOutBuf(&bench->out);
+	freeEncoder(&bench->encoder);
+	freeImage(&bench->prevImage);
+
+	if(bench->threads > 1)
+	{
+		stopWorkers(&bench->workers);
+		freeEncoder(&bench->single);
+		freeImage(&bench->singleImage);
+	}
+
+	if(bench->graphics == GRAPHICS_SIXEL)
+		freeSixel(&bench->sixel);
+	else if(bench->graphics == GRAPHICS_KITTY)
+		freeKitty(&bench->kitty);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Audio
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+// the audio stream as probed by openDecoder(), so the audio thread doesn't have
+// to probe the file a second time (see getAudioStream())
+typedef struct AudioStream
+{
+	int stream; // -1 = no audio
+	AVCodecParameters *codecpar;
+	double timeBase;
+	int64_t startPts;
+}AudioStream;
+
+// decodes the audio stream on its own thread and streams it to miniaudio
+// through a ring buffer (no wav file, playback starts right away)
+typedef struct Audio
+{
+	AVFormatContext *formatCtx;
+	AVCodecContext *codecCtx;
+	struct SwrContext *swrCtx;
+	AVPacket *packet;
+	AVFrame *frame;
+	int stream;
+	int channels;
+	int sampleRate;
+	double timeBase;
+	int64_t startPts;
+
+	// converted samples waiting to be written to the ring
+	float *samples;
+	int samplesSize;
+
+	ma_pcm_rb ring;
+	ma_device device;
+	pthread_t thread;
+	int started;
+
+	atomic_int quit;
+	atomic_int eof;
+
+	// media position (in frames) of the audio handed to the device, this is
+	// the master clock for the video. Only the callback changes it.
+	atomic_llong position;
+	atomic_llong positionTime; // getTime() when position last changed
+	int64_t latency; // ns
+	int64_t period; // ns of audio the device asks for at once
+
+	// seek requests from the renderer, every seek gets a new serial
+	pthread_mutex_t seekLock;
+	atomic_int seekSerial;
+	double seekTo;
+
+	// the decoder stops writing samples of older seeks, sets flushPosition
+	// and then flushSerial. The callback empties the ring, starts the clock
+	// at flushPosition and sets drainedSerial to match.
+	int serial; // of the samples the decoder writes
+	int64_t flushPosition;
+	atomic_int flushSerial;
+	atomic_int drainedSerial;
+}Audio;
+
+// seconds of audio to buffer
+#define AUDIO_BUFFER 0.5
+
+Audio audio;
+
+void data_callback(
+	ma_device* pDevice, void* pOutput, const void* pInput, ma_uint32 frameCount
+)
+{
+	Audio *audio = (Audio*)pDevice->pUserData;
+	float *output = pOutput;
+
+	// drop everything decoded before a seek. The decoder doesn't write until
+	// drainedSerial is updated, so only old samples are thrown away.
+	int flush = atomic_load(&audio->flushSerial);
+	if(flush != atomic_load(&audio->drainedSerial))
+	{
+		ma_pcm_rb_seek_read(&audio->ring, ma_pcm_rb_available_read(&audio->ring));
+		atomic_store(&audio->position, audio->flushPosition);
+		atomic_store(&audio->positionTime, getTime());
+		atomic_store(&audio->drainedSerial, flush);
+	}
+
+	// samples left over from before a newer seek don't move the clock (and
+	// if it is moved anyway, the next flush sets it again)
+	int counting = flush == atomic_load(&audio->seekSerial);
+
+	ma_uint32 done = 0;
+
+	// the ring may wrap, so this can take two reads
+	while(done < frameCount)
+	{
+		ma_uint32 count = frameCount - done;
+		void *buffer;
+
+		ma_pcm_rb_acquire_read(&audio->ring, &count, &buffer);
+
+		if(count == 0)
+			break;
+
+		memcpy(
+			output + done * audio->channels, buffer,
+			count * audio->channels * sizeof(float)
+		);
+
+		ma_pcm_rb_commit_read(&audio->ring, count, buffer);
+		done += count;
+	}
+
+	// whatever is left stays silent (the output buffer is zeroed)
+
+	if(counting)
+	{
+		atomic_fetch_add(&audio->position, done);
+		atomic_store(&audio->positionTime, getTime());
+	}
+
+	(void)pInput;
+}
+
+// returns 0 if the file has no (playable) audio. The audio thread reads
+// packets on its own, so it gets its own demuxer, but the stream info comes
+// from STREAM.
+int openAudio(Audio *audio, const char TARGET[], const AudioStream *STREAM)
+{
+	if(STREAM->stream < 0)
+		return(0);
+
+	if(avformat_open_input(&audio->formatCtx, TARGET, NULL, NULL) < 0)
+		return(0);
+
+	// some formats only find their streams while reading (e.g. mpeg-ts), those
+	// still have to be probed
+	if(
+		(int)audio->formatCtx->nb_streams <= STREAM->stream &&
+		avformat_find_stream_info(audio->formatCtx, NULL) < 0
+	)
+		return(0);
+
+	if((int)audio->formatCtx->nb_streams <= STREAM->stream)
+		return(0);
+
+	audio->stream = STREAM->stream;
+
+	const AVCodec *codec = avcodec_find_decoder(STREAM->codecpar->codec_id);
+
+	if(codec == NULL)
+		return(0);
+
+	audio->codecCtx = avcodec_alloc_context3(codec);
+
+	if(audio->codecCtx == NULL)
+		error("failed to allocate memory for audio codecCtx");
+
+	avcodec_parameters_to_context(audio->codecCtx, STREAM->codecpar);
+
+	if(avcodec_open2(audio->codecCtx, codec, NULL) < 0)
+		return(0);
+
+	AVCodecContext *codecCtx = audio->codecCtx;
+	audio->sampleRate = codecCtx->sample_rate;
+
+	// everything is converted to interleaved float, at most stereo
+	#if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 28, 100)
+		audio->channels = codecCtx->ch_layout.nb_channels > 1 ? 2 : 1;
+
+		AVChannelLayout outLayout;
+		av_channel_layout_default(&outLayout, audio->channels);
+
+		swr_alloc_set_opts2(
+			&audio->swrCtx,
+			&outLayout, AV_SAMPLE_FMT_FLT, audio->sampleRate,
+			&codecCtx->ch_layout, codecCtx->sample_fmt, audio->sampleRate,
+			0, NULL
+		);
+	#else
+		audio->channels = codecCtx->channels > 1 ? 2 : 1;
+
+		int64_t inLayout = codecCtx->channel_layout;
+		if(inLayout == 0)
+			inLayout = av_get_default_channel_layout(codecCtx->channels);
+
+		audio->swrCtx = swr_alloc_set_opts(
+			NULL,
+			av_get_default_channel_layout(audio->channels),
+			AV_SAMPLE_FMT_FLT, audio->sampleRate,
+			inLayout, codecCtx->sample_fmt, audio->sampleRate,
+			0, NULL
+		);
+	#endif
+
+	if(audio->swrCtx == NULL || swr_init(audio->swrCtx) < 0)
+		error("could not create audio resampler");
+
+	audio->packet = av_packet_alloc();
+	audio->frame = av_frame_alloc();
+
+	if(audio->packet == NULL || audio->frame == NULL)
+		error("failed to allocate memory for audio decoder");
+
+	audio->timeBase = STREAM->timeBase;
+	audio->startPts = STREAM->startPts;
+
+	if(
+		ma_pcm_rb_init(
+			ma_format_f32, audio->channels,
+			(ma_uint32)(audio->sampleRate * AUDIO_BUFFER), NULL, NULL,
+			&audio->ring
+		) != MA_SUCCESS
+	)
+		error("failed to allocate memory for audio ring");
+
+	atomic_init(&audio->quit, 0);
+	atomic_init(&audio->eof, 0);
+	atomic_init(&audio->position, 0);
+	atomic_init(&audio->positionTime, getTime());
+	atomic_init(&audio->seekSerial, 0);
+	atomic_init(&audio->flushSerial, 0);
+	atomic_init(&audio->drainedSerial, 0);
+	audio->serial = 0;
+	pthread_mutex_init(&audio->seekLock, NULL);
+
+	debug(
+		"opened audio: stream %d, %d Hz, %d channels",
+		audio->stream, audio->sampleRate, audio->channels
+	);
+
+	return(1);
+}
+
+// copies COUNT converted frames into the ring, waiting while it is full.
+// Returns 0 if interrupted by a seek or quit.
+int writeAudio(Audio *audio, const float *SAMPLES, int count)
+{
+	while(count > 0)
+	{
+		if(
+			atomic_load(&audio->quit) == 1 ||
+			atomic_load(&audio->seekSerial) != audio->serial
+		)
+			return(0);
+
+		ma_uint32 size = count;
+		void *buffer;
+
+		ma_pcm_rb_acquire_write(&audio->ring, &size, &buffer);
+
+		if(size == 0)
+		{
+			nanosleep(&(struct timespec){0, 5000000}, NULL);
+			continue;
+		}
+
+		memcpy(buffer, SAMPLES, size * audio->channels * sizeof(float));
+		ma_pcm_rb_commit_write(&audio->ring, size, buffer);
+
+		SAMPLES += size * audio->channels;
+		count -= size;
+	}
+
+	return(1);
+}
+
+// converts audio->frame and writes it to the ring, skipping the samples
+// before SKIP_UNTIL (seconds)
+void queueAudioFrame(Audio *audio, const double SKIP_UNTIL)
+{
+	AVFrame *frame = audio->frame;
+
+	int size = swr_get_out_samples(audio->swrCtx, frame->nb_samples);
+
+	if(size > audio->samplesSize)
+	{
+		audio->samplesSize = size;
+		audio->samples = realloc(
+			audio->samples, size * audio->channels * sizeof(float)
+		);
+
+		if(audio->samples == NULL)
+			error("failed to allocate memory for audio samples");
+	}
+
+	uint8_t *out[] = {(uint8_t*)audio->samples};
+
+	int count = swr_convert(
+		audio->swrCtx, out, size,
+		(const uint8_t**)frame->extended_data, frame->nb_samples
+	);
+
+	if(count <= 0)
+		return;
+
+	int skip = 0;
+
+	if(frame->best_effort_timestamp != AV_NOPTS_VALUE)
+	{
+		double pts
+			= (frame->best_effort_timestamp - audio->startPts) * audio->timeBase;
+
+		if(pts < SKIP_UNTIL)
+			skip = (int)((SKIP_UNTIL - pts) * audio->sampleRate);
+	}
+
+	if(skip >= count)
+		return;
+
+	writeAudio(audio, audio->samples + skip * audio->channels, count - skip);
+}
+
+void *audioLoop(void *arg)
+{
+	Audio *audio = arg;
+	double skipUntil = 0;
+
+	while(atomic_load(&audio->quit) == 0)
+	{
+		if(atomic_load(&audio->seekSerial) != audio->serial)
+		{
+			pthread_mutex_lock(&audio->seekLock);
+			skipUntil = audio->seekTo;
+			audio->serial = atomic_load(&audio->seekSerial);
+			pthread_mutex_unlock(&audio->seekLock);
+
+			// nothing older is written from here on, so the callback can drop
+			// the old samples and restart the clock
+			audio->flushPosition = (int64_t)(skipUntil * audio->sampleRate);
+			atomic_store(&audio->flushSerial, audio->serial);
+
+			av_seek_frame(
+				audio->formatCtx, audio->stream,
+				(int64_t)(skipUntil / audio->timeBase) + audio->startPts,
+				AVSEEK_FLAG_BACKWARD
+			);
+
+			avcodec_flush_buffers(audio->codecCtx);
+			atomic_store(&audio->eof, 0);
+
+			// wait for the callback to empty the ring
+			while(
+				atomic_load(&audio->drainedSerial) != audio->serial &&
+				atomic_load(&audio->quit) == 0
+			)
+				nanosleep(&(struct timespec){0, 1000000}, NULL);
+		}
+
+		int result = avcodec_receive_frame(audio->codecCtx, audio->frame);
+
+		if(result == 0)
+		{
+			queueAudioFrame(audio, skipUntil);
+			continue;
+		}
+
+		// end of the file, wait in case the renderer seeks back
+		if(result == AVERROR_EOF)
+		{
+			atomic_store(&audio->eof, 1);
+			nanosleep(&(struct timespec){0, 10000000}, NULL);
+			continue;
+		}
+
+		// a damaged frame is left out, the ones after it still decode
+		if(result != AVERROR(EAGAIN))
+			debug("could not decode audio frame: %s", av_err2str(result));
+
+		if(av_read_frame(audio->formatCtx, audio->packet) < 0)
+		{
+			// flush the frames left in the codec (fails harmlessly if that
+			// was already done)
+			atomic_store(&audio->eof, 1);
+			avcodec_send_packet(audio->codecCtx, NULL);
+			continue;
+		}
+
+		if(audio->packet->stream_index == audio->stream)
+		{
+			result = avcodec_send_packet(audio->codecCtx, audio->packet);
+			if(result < 0)
+				debug("skipped audio packet: %s", av_err2str(result));
+		}
+
+		av_packet_unref(audio->packet);
+	}
+
+	return(NULL);
+}
+
+// starts decoding TARGET's audio and plays it once some is buffered
+void playAudio(const char TARGET[], const AudioStream *STREAM)
+{
+	memset(&audio, 0, sizeof(Audio));
+
+	if(openAudio(&audio, TARGET, STREAM) == 0)
+	{
+		debug("no audio stream, playing without sound");
+		return;
+	}
+
+	if(pthread_create(&audio.thread, NULL, audioLoop, &audio) != 0)
+		error("could not start audio thread");
+
+	audio.started = 1;
+
+	// give the decoder a head start so playback doesn't begin with a gap
+	for(int i = 0; i < 1000; i++)
+	{
+		if(
+			ma_pcm_rb_available_read(&audio.ring)
+				>= (ma_uint32)audio.sampleRate / 10 ||
+			atomic_load(&audio.eof) == 1
+		)
+			break;
+
+		nanosleep(&(struct timespec){0, 1000000}, NULL);
+	}
+
+	ma_device_config deviceConfig;
+	deviceConfig = ma_device_config_init(ma_device_type_playback);
+	deviceConfig.playback.format   = ma_format_f32;
+	deviceConfig.playback.channels = audio.channels;
+	deviceConfig.sampleRate        = audio.sampleRate;
+	deviceConfig.dataCallback      = data_callback;
+	deviceConfig.pUserData         = &audio;
+
+	if(ma_device_init(NULL, &deviceConfig, &audio.device) != MA_SUCCESS)
+		error("could not initialize device (use -s to disable audio)");
+
+	if(ma_device_start(&audio.device) != MA_SUCCESS)
+		error("could not start device (use -s to disable audio)");
+
+	// samples handed to the device are heard about one buffer later
+	audio.latency = av_rescale(
+		(int64_t)audio.device.playback.internalPeriodSizeInFrames
+			* audio.device.playback.internalPeriods,
+		NS_PER_SEC, audio.device.playback.internalSampleRate
+	);
+
+	audio.period = av_rescale(
+		audio.device.playback.internalPeriodSizeInFrames,
+		NS_PER_SEC, audio.device.playback.internalSampleRate
+	);
+
+	debug("audio latency: %f ms", (double)audio.latency / 1000000);
+}
+
+// ns of audio heard so far, -1 if there is no audio (or it has ended)
+int64_t getAudioClock()
+{
+	if(audio.started == 0)
+		return(-1);
+
+	if(
+		atomic_load(&audio.eof) == 1 &&
+		ma_pcm_rb_available_read(&audio.ring) == 0
+	)
+		return(-1);
+
+	// a seek the callback hasn't caught up with yet
+	if(atomic_load(&audio.drainedSerial) != atomic_load(&audio.seekSerial))
+	{
+		pthread_mutex_lock(&audio.seekLock);
+		int64_t time = (int64_t)(audio.seekTo * NS_PER_SEC);
+		pthread_mutex_unlock(&audio.seekLock);
+		return(time);
+	}
+
+	// the position only moves once per callback, in between the time since
+	// then is added (at most one period, in case the callback is late)
+	int64_t position, since;
+	do
+	{
+		since = atomic_load(&audio.positionTime);
+		position = atomic_load(&audio.position);
+	}
+	while(since != atomic_load(&audio.positionTime));
+
+	int64_t elapsed = getTime() - since;
+	if(elapsed > audio.period) elapsed = audio.period;
+
+	int64_t time
+		= av_rescale(position, NS_PER_SEC, audio.sampleRate)
+		+ elapsed - audio.latency;
+
+	return(time < 0 ? 0 : time);
+}
+
+// TIME is in ns
+void seekAudio(const int64_t TIME)
+{
+	if(audio.started == 0)
+		return;
+
+	pthread_mutex_lock(&audio.seekLock);
+	audio.seekTo = (double)TIME / NS_PER_SEC;
+	atomic_fetch_add(&audio.seekSerial, 1);
+	pthread_mutex_unlock(&audio.seekLock);
+}
+
+void stopAudio()
+{
+	if(audio.started == 0)
+		return;
+
+	ma_device_uninit(&audio.device);
+
+	atomic_store(&audio.quit, 1);
+	pthread_join(audio.thread, NULL);
+
+	ma_pcm_rb_uninit(&audio.ring);
+	swr_free(&audio.swrCtx);
+	av_frame_free(&audio.frame);
+	av_packet_free(&audio.packet);
+	avcodec_free_context(&audio.codecCtx);
+	avformat_close_input(&audio.formatCtx);
+	pthread_mutex_destroy(&audio.seekLock);
+	free(audio.samples);
+
+	audio.started = 0;
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Image
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+int getImageWidth(const char TARGET[])
+{
+	int width = -1;
+	stbi_load(TARGET, &width, NULL, NULL, 3);
+	return(width);
+}
+
+int getImageHeight(const char TARGET[])
+{
+	int height = -1;
+	stbi_load(TARGET, NULL, &height, NULL, 3);
+	return(height);
+}
+
+Image loadImage(const char TARGET[])
+{
+	Image image;
+
+	unsigned char *imageRaw = stbi_load(
+		TARGET, &image.width, &image.height, NULL, 3
+	);
+
+	if(imageRaw == NULL)
+		error("could not open %s (it may be corrupt)", TARGET);
+
+	image.pixels = (Pixel*)malloc((image.width * image.height) * sizeof(Pixel));
+	image.hashes = NULL;
+	image.glyphs = NULL;
+
+	if(image.pixels == NULL)
+		error("failed to allocate memory for image");
+
+	//debug("allocated mempry for image");
+
+	// Convert to "Image" type (easier to use)
+	for(int i = 0; i < image.height; i++)
+	{
+		for(int j = 0; j < image.width; j++)
+		{
+			image.pixels[i * image.width + j].r
+				= imageRaw[i * image.width * 3 + j * 3];
+			image.pixels[i * image.width + j].g
+				= imageRaw[i * image.width * 3 + j * 3 + 1];
+			image.pixels[i * image.width + j].b
+				= imageRaw[i * image.width * 3 + j * 3 + 2];
+			image.pixels[i * image.width + j].pad = 0;
+		}
+	}
+
+	free(imageRaw);
+	return(image);
+}
+
+Image scaleImage(Image oldImage, float zoomX, float zoomY)
+{
+	Image newImage;
+	newImage.width = (int)(oldImage.width * zoomX);
+	newImage.height = (int)(oldImage.height * zoomY);
+	float xPixelWidth = 1 / zoomX;
+	float yPixelWidth = 1 / zoomY;
+
+	newImage.pixels
+		= (Pixel*)malloc((newImage.width * newImage.height) * sizeof(Pixel));
+	newImage.hashes = NULL;
+	newImage.glyphs = NULL;
+
+	if(newImage.pixels == NULL)
+		error("failed to allocate memory for newImage");
+
+	debug("allocated memory for newImage");
+
+	for(int i = 0; i < newImage.height; i++)
+	{
+		for(int j = 0; j < newImage.width; j++)
+		{
+			#define pixel newImage.pixels[i * newImage.width + j]
+
+			// pixels only hold 8 bits, so the sums are kept separately
+			int r = 0;
+			int g = 0;
+			int b = 0;
+			int count = 0;
+
+			// take the average of all points
+			for(float k = 0; k < yPixelWidth; k += yPixelWidth / SCALE)
+			{
+				for(float l = 0; l < xPixelWidth; l += xPixelWidth / SCALE)
+				{
+					#define samplePoint oldImage.pixels\
+					[(int)(floor(i * yPixelWidth + k) * oldImage.width)\
+					 + (int)floor(j * xPixelWidth + l)]
+
+					r += samplePoint.r;
+					g += samplePoint.g;
+					b += samplePoint.b;
+					count++;
+				}
+			}
+
+			pixel.r = (int)((float)r / (float)count);
+			pixel.g = (int)((float)g / (float)count);
+			pixel.b = (int)((float)b / (float)count);
+			pixel.pad = 0;
+		}
+	}
+	return(newImage);
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Video
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-------- decoder -----------------------------------------------------------//
+
+// demuxes and decodes the video stream inside tmv (no ffmpeg process and no
+// bmp files in /tmp/tmv)
+typedef struct Decoder
+{
+	AVFormatContext *formatCtx;
+	AVCodecContext *codecCtx;
+	AVPacket *packet;
+	AVFrame *frame; // newest frame that is due (ready to be shown)
+	AVFrame *next;  // first frame that is not due yet
+	int stream;
+	int hasNext;
+	int eof;
+	double nextPts;
+	double timeBase;
+	int64_t startPts;
+
+	// sorted pts of the keyframes seen so far (used for seeking)
+	int64_t *keyframes;
+	int keyframeCount;
+	int keyframeSize;
+}Decoder;
+
+void addKeyframe(Decoder *decoder, const int64_t PTS)
+{
+	if(PTS == AV_NOPTS_VALUE)
+		return;
+
+	// find where PTS goes (keyframes nearly always arrive in order)
+	int index = decoder->keyframeCount;
+	while(index > 0 && decoder->keyframes[index - 1] >= PTS)
+	{
+		if(decoder->keyframes[index - 1] == PTS)
+			return;
+		index--;
+	}
+
+	if(decoder->keyframeCount == decoder->keyframeSize)
+	{
+		decoder->keyframeSize = max(256, decoder->keyframeSize * 2);
+		decoder->keyframes = realloc(
+			decoder->keyframes, decoder->keyframeSize * sizeof(int64_t)
+		);
+
+		if(decoder->keyframes == NULL)
+			error("failed to allocate memory for keyframe index");
+	}
+
+	memmove(
+		&decoder->keyframes[index + 1], &decoder->keyframes[index],
+		(decoder->keyframeCount - index) * sizeof(int64_t)
+	);
+
+	decoder->keyframes[index] = PTS;
+	decoder->keyframeCount++;
+}
+
+// seeds the keyframe index with the container's index (if it has one)
+void indexKeyframes(Decoder *decoder)
+{
+	AVStream *stream = decoder->formatCtx->streams[decoder->stream];
+
+	#if LIBAVFORMAT_VERSION_INT >= AV_VERSION_INT(58, 78, 100)
+		int count = avformat_index_get_entries_count(stream);
+		for(int i = 0; i < count; i++)
+		{
+			const AVIndexEntry *entry = avformat_index_get_entry(stream, i);
+			if(entry->flags & AVINDEX_KEYFRAME)
+				addKeyframe(decoder, entry->timestamp);
+		}
+	#else
+		for(int i = 0; i < stream->nb_index_entries; i++)
+		{
+			if(stream->index_entries[i].flags & AVINDEX_KEYFRAME)
+				addKeyframe(decoder, stream->index_entries[i].timestamp);
+		}
+	#endif
+
+	debug("indexed %d keyframes", decoder->keyframeCount);
+}
+
+void openDecoder(Decoder *decoder, const char TARGET[], const int THREADS)
+{
+	memset(decoder, 0, sizeof(Decoder));
+
+	#if LIBAVFORMAT_VERSION_INT < AV_VERSION_INT(58, 9, 100)
+		av_register_all();
+	#endif
+
+	if(avformat_open_input(&decoder->formatCtx, TARGET, NULL, NULL) < 0)
+		error("failed to open file");
+
+	if(avformat_find_stream_info(decoder->formatCtx, NULL) < 0)
+		error("could not find stream info");
+
+	decoder->stream = av_find_best_stream(
+		decoder->formatCtx, AVMEDIA_TYPE_VIDEO, -1, -1, NULL, 0
+	);
+
+	if(decoder->stream < 0)
+		error("could not find a video stream");
+
+	AVStream *stream = decoder->formatCtx->streams[decoder->stream];
+
+	const AVCodec *codec = avcodec_find_decoder(stream->codecpar->codec_id);
+
+	if(codec == NULL)
+		error("unsupported codec");
+
+	decoder->codecCtx = avcodec_alloc_context3(codec);
+
+	if(decoder->codecCtx == NULL)
+		error("failed to allocate memory for codecCtx");
+
+	avcodec_parameters_to_context(decoder->codecCtx, stream->codecpar);
+
+	// let libavcodec use frame and slice threads (whichever the codec supports)
+	decoder->codecCtx->thread_count = THREADS;
+	decoder->codecCtx->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
+	if(avcodec_open2(decoder->codecCtx, codec, NULL) < 0)
+		error("could not open codec");
+
+	decoder->packet = av_packet_alloc();
+	decoder->frame = av_frame_alloc();
+	decoder->next = av_frame_alloc();
+
+	if(
+		decoder->packet == NULL ||
+		decoder->frame == NULL ||
+		decoder->next == NULL
+	)
+		error("failed to allocate memory for decoder");
+
+	decoder->timeBase = av_q2d(stream->time_base);
+	decoder->startPts
+		= stream->start_time == AV_NOPTS_VALUE ? 0 : stream->start_time;
+
+	indexKeyframes(decoder);
+
+	debug(
+		"opened decoder: stream %d, %d * %d, %d threads",
+		decoder->stream, decoder->codecCtx->width, decoder->codecCtx->height,
+		decoder->codecCtx->thread_count
+	);
+}
+
+// decodes the next frame into decoder->next, returns 0 at the end of the file
+int readFrame(Decoder *decoder)
+{
+	while(1)
+	{
+		int result = avcodec_receive_frame(decoder->codecCtx, decoder->next);
+
+		if(result == 0)
+		{
+			int64_t pts = decoder->next->best_effort_timestamp;
+			if(pts == AV_NOPTS_VALUE) pts = decoder->startPts;
+
+			decoder->nextPts = (pts - decoder->startPts) * decoder->timeBase;
+			return(1);
+		}
+
+		if(result == AVERROR_EOF)
+			return(0);
+
+		// a damaged frame (broken packet, cut off download) is left out, the
+		// ones after it still decode
+		if(result != AVERROR(EAGAIN))
+			debug("could not decode video frame: %s", av_err2str(result));
+
+		// decoder needs more data
+		if(decoder->eof)
+			return(0);
+
+		if(av_read_frame(decoder->formatCtx, decoder->packet) < 0)
+		{
+			// flush the frames left in the codec
+			decoder->eof = 1;
+			result = avcodec_send_packet(decoder->codecCtx, NULL);
+			if(result < 0)
+				debug("could not flush video decoder: %s", av_err2str(result));
+			continue;
+		}
+
+		if(decoder->packet->stream_index == decoder->stream)
+		{
+			if(decoder->packet->flags & AV_PKT_FLAG_KEY)
+				addKeyframe(decoder, decoder->packet->pts);
+
+			result = avcodec_send_packet(decoder->codecCtx, decoder->packet);
+			if(result < 0)
+				debug("skipped video packet: %s", av_err2str(result));
+		}
+
+		av_packet_unref(decoder->packet);
+	}
+}
+
+// decodes every frame due at TIME (seconds), frames that are overtaken by a
+// newer one are dropped without being converted. Returns 1 if decoder->frame
+// was replaced, -1 if there are no frames left.
+int decodeUntil(Decoder *decoder, const double TIME)
+{
+	int updated = 0;
+
+	if(decoder->hasNext == 0 && decoder->eof == 0)
+		decoder->hasNext = readFrame(decoder);
+
+	while(decoder->hasNext == 1 && decoder->nextPts <= TIME)
+	{
+		av_frame_unref(decoder->frame);
+		av_frame_move_ref(decoder->frame, decoder->next);
+		decoder->hasNext = readFrame(decoder);
+		updated = 1;
+	}
+
+	if(updated == 0 && decoder->hasNext == 0)
+		return(-1);
+
+	return(updated);
+}
+
+// jumps to the last keyframe before TIME (seconds), the next decodeUntil()
+// then decodes forward to the exact frame
+void seekDecoder(Decoder *decoder, const double TIME)
+{
+	int64_t target = (int64_t)(TIME / decoder->timeBase) + decoder->startPts;
+
+	// binary search for the last known keyframe at or before target
+	int low = 0;
+	int high = decoder->keyframeCount - 1;
+	int found = -1;
+
+	while(low <= high)
+	{
+		int mid = (low + high) / 2;
+		if(decoder->keyframes[mid] <= target)
+		{
+			found = mid;
+			low = mid + 1;
+		}
+		else
+			high = mid - 1;
+	}
+
+	// targets past the indexed part let libavformat find the keyframe
+	int64_t timestamp = target;
+	if(found != -1 && found < decoder->keyframeCount - 1)
+		timestamp = decoder->keyframes[found];
+
+	av_seek_frame(
+		decoder->formatCtx, decoder->stream, timestamp, AVSEEK_FLAG_BACKWARD
+	);
+
+	avcodec_flush_buffers(decoder->codecCtx);
+	av_frame_unref(decoder->frame);
+	av_frame_unref(decoder->next);
+	decoder->hasNext = 0;
+	decoder->eof = 0;
+}
+
+void closeDecoder(Decoder *decoder)
+{
+	free(decoder->keyframes);
+	decoder->keyframes = NULL;
+
+	av_frame_free(&decoder->frame);
+	av_frame_free(&decoder->next);
+	av_packet_free(&decoder->packet);
+	avcodec_free_context(&decoder->codecCtx);
+	avformat_close_input(&decoder->formatCtx);
+}
+
+//-------- scaler ------------------------------------------------------------//
+
+// scales decoded frames straight to the cell grid. The grid is split into
+// horizontal bands and every band has its own swscale context that reads only
+// the source rows it needs, so the bands can be scaled in parallel and no
+// full resolution rgb frame is ever made.
+typedef struct Scaler
+{
+	int bands;
+	int srcWidth;
+	int srcHeight;
+	int srcFormat;
+	int srcShift; // vertical chroma subsampling of the source
+	int *srcY;    // first source row of every band (bands + 1 entries)
+	int *dstY;    // first grid row of every band (bands + 1 entries)
+	struct SwsContext **contexts;
+	Workers *workers;
+	const Palette *palette; // NULL for truecolor
+
+	// glyph modes scale into sub-pixels and fit the cells from those
+	const Glyphs *glyphs; // NULL for half blocks
+	Pixel *sub;
+	int subWidth;
+
+	// current job
+	AVFrame *frame;
+	Image *image;
+}Scaler;
+
+void freeScaler(Scaler *scaler)
+{
+	for(int i = 0; i < scaler->bands; i++)
+		sws_freeContext(scaler->contexts[i]);
+
+	free(scaler->contexts);
+	free(scaler->srcY);
+	free(scaler->dstY);
+	free(scaler->sub);
+
+	scaler->contexts = NULL;
+	scaler->srcY = NULL;
+	scaler->dstY = NULL;
+	scaler->sub = NULL;
+	scaler->bands = 0;
+}
+
+void initScaler(Scaler *scaler, const AVFrame *FRAME, const Image *IMAGE)
+{
+	freeScaler(scaler);
+
+	const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get(FRAME->format);
+
+	if(desc == NULL)
+		error("unknown pixel format");
+
+	// size swscale scales to, bands are split on whole cells (step rows)
+	int width = IMAGE->width;
+	int height = IMAGE->height;
+	int step = 1;
+
+	if(scaler->glyphs != NULL)
+	{
+		width *= scaler->glyphs->width;
+		step = scaler->glyphs->height;
+		height = IMAGE->height / 2 * step;
+
+		scaler->subWidth = width;
+		scaler->sub = malloc((long)width * height * sizeof(Pixel));
+
+		if(scaler->sub == NULL)
+			error("failed to allocate memory for scaler");
+	}
+
+	int bands = scaler->workers->count;
+
+	// palette and bitstream formats can't be split into rows
+	if(desc->flags & (AV_PIX_FMT_FLAG_PAL | AV_PIX_FMT_FLAG_BITSTREAM))
+		bands = 1;
+
+	// keep at least two grid rows per band
+	if(bands > height / step / 2) bands = max(1, height / step / 2);
+
+	scaler->srcWidth = FRAME->width;
+	scaler->srcHeight = FRAME->height;
+	scaler->srcFormat = FRAME->format;
+	scaler->srcShift = desc->log2_chroma_h;
+
+	scaler->srcY = malloc((bands + 1) * sizeof(int));
+	scaler->dstY = malloc((bands + 1) * sizeof(int));
+	scaler->contexts = calloc(bands, sizeof(struct SwsContext*));
+
+	if(
+		scaler->srcY == NULL ||
+		scaler->dstY == NULL ||
+		scaler->contexts == NULL
+	)
+		error("failed to allocate memory for scaler");
+
+	// source rows have to start on a chroma row
+	int align = 1 << scaler->srcShift;
+
+	int count = 0;
+	scaler->srcY[0] = 0;
+	scaler->dstY[0] = 0;
+
+	for(int i = 1; i < bands; i++)
+	{
+		int dstY = i * (height / step) / bands * step;
+		int srcY = (int)((long)dstY * FRAME->height / height);
+		srcY -= srcY % align;
+
+		if(dstY <= scaler->dstY[count] || srcY <= scaler->srcY[count])
+			continue;
+
+		count++;
+		scaler->srcY[count] = srcY;
+		scaler->dstY[count] = dstY;
+	}
+
+	count++;
+	scaler->srcY[count] = FRAME->height;
+	scaler->dstY[count] = height;
+	scaler->bands = count;
+
+	for(int i = 0; i < scaler->bands; i++)
+	{
+		scaler->contexts[i] = sws_getContext(
+			FRAME->width, scaler->srcY[i + 1] - scaler->srcY[i], FRAME->format,
+			width, scaler->dstY[i + 1] - scaler->dstY[i], AV_PIX_FMT_RGB0,
+			SWS_AREA, NULL, NULL, NULL
+		);
+
+		if(scaler->contexts[i] == NULL)
+			error("could not create scaler");
+	}
+
+	debug(
+		"scaler: %d * %d -> %d * %d in %d bands",
+		FRAME->width, FRAME->height, width, height,
+		scaler->bands
+	);
+}
+
+void scaleBand(void *arg, int band)
+{
+	Scaler *scaler = arg;
+
+	if(band >= scaler->bands)
+		return;
+
+	AVFrame *frame = scaler->frame;
+	Image *image = scaler->image;
+
+	const uint8_t *src[4] = {NULL};
+	int srcStride[4] = {0};
+
+	for(int i = 0; i < 4 && frame->data[i] != NULL; i++)
+	{
+		// planes 1 and 2 hold the (subsampled) chroma
+		int row = scaler->srcY[band];
+		if(i == 1 || i == 2) row >>= scaler->srcShift;
+
+		src[i] = frame->data[i] + (long)row * frame->linesize[i];
+		srcStride[i] = frame->linesize[i];
+	}
+
+	int dstY = scaler->dstY[band];
+	int rows = scaler->dstY[band + 1] - dstY;
+
+	// pixels have the same layout as RGB0, so swscale writes them directly
+	uint8_t *dst[4] = {(uint8_t*)(image->pixels + (long)dstY * image->width)};
+	int dstStride[4] = {image->width * sizeof(Pixel)};
+
+	if(scaler->glyphs != NULL)
+	{
+		dst[0] = (uint8_t*)(scaler->sub + (long)dstY * scaler->subWidth);
+		dstStride[0] = scaler->subWidth * sizeof(Pixel);
+	}
+
+	sws_scale(
+		scaler->contexts[band],
+		src, srcStride,
+		0, scaler->srcY[band + 1] - scaler->srcY[band],
+		dst, dstStride
+	);
+
+	// image rows of this band
+	int from = dstY;
+	int to = dstY + rows;
+
+	if(scaler->glyphs != NULL)
+	{
+		int step = scaler->glyphs->height;
+		from = dstY / step * 2;
+		to = (dstY + rows) / step * 2;
+
+		for(int i = from; i < to; i += 2)
+			fitCells(
+				scaler->glyphs,
+				scaler->sub + (long)i / 2 * step * scaler->subWidth,
+				scaler->subWidth, image->width,
+				image->pixels + (long)i * image->width,
+				image->pixels + (long)(i + 1) * image->width,
+				image->glyphs + (long)i / 2 * image->width
+			);
+	}
+
+	// quantized and hashed here (in parallel) so the renderer can skip
+	// unchanged rows
+	if(scaler->palette != NULL)
+		ditherRows(scaler->palette, image, from, to);
+
+	for(int i = from; i < to; i++)
+		image->hashes[i] = hashRow(image->pixels + i * image->width, image->width);
+
+	if(scaler->glyphs != NULL)
+		for(int i = from + 1; i < to; i += 2)
+			image->hashes[i] = hashGlyphs(
+				image->hashes[i], image->glyphs + (long)i / 2 * image->width,
+				image->width
+			);
+}
+
+// scales FRAME into IMAGE (the cell grid) using all workers
+void scaleFrame(Scaler *scaler, AVFrame *frame, Image *image)
+{
+	if(
+		scaler->bands == 0 ||
+		scaler->srcWidth != frame->width ||
+		scaler->srcHeight != frame->height ||
+		scaler->srcFormat != frame->format
+	)
+		initScaler(scaler, frame, image);
+
+	scaler->frame = frame;
+	scaler->image = image;
+
+	runWorkers(scaler->workers, scaleBand, scaler);
+}
+
+//-------- frame queue -------------------------------------------------------//
+
+// bounded single producer / single consumer ring of pre-allocated frames
+// between the decode thread and the renderer. The decoder blocks when the ring
+// is full, so memory use never grows past the limits given to initQueue().
+
+// longest a queue wait sleeps without being signalled (ns)
+#define QUEUE_WAIT (NS_PER_SEC / 10)
+
+typedef struct FrameQueue
+{
+	int capacity;
+	Image *frames;
+	int64_t *pts; // ns
+	int *serials; // seek serial each frame was decoded for
+	atomic_ulong head; // only written by the decoder
+	atomic_ulong tail; // only written by the renderer
+	atomic_long clock; // frame index the renderer is showing
+	atomic_int eof; // serial that reached the end of the file (-1 = none)
+	atomic_int quit;
+
+	// pipes that wake up the other side instead of it polling: a byte goes
+	// into pushed when a frame is queued or the end is reached, and into
+	// popped when frames are handed back, a seek is requested or on quit
+	int pushed[2];
+	int popped[2];
+
+	// seek requests from the renderer
+	pthread_mutex_t seekLock;
+	atomic_int seeking;
+	long seekTo;
+	int seekSerial;
+}FrameQueue;
+
+void initQueue(
+	FrameQueue *queue, const int WIDTH, const int HEIGHT, const int GLYPHS,
+	const int MAX_FRAMES, const int MAX_MB
+)
+{
+	long frameBytes = (long)WIDTH * HEIGHT * sizeof(Pixel);
+	if(GLYPHS == 1) frameBytes += (long)WIDTH * (HEIGHT / 2);
+
+	queue->capacity = MAX_FRAMES;
+	if(queue->capacity > MAX_MB * 1048576L / frameBytes)
+		queue->capacity = MAX_MB * 1048576L / frameBytes;
+	if(queue->capacity < 1)
+		queue->capacity = 1;
+
+	queue->frames = malloc(queue->capacity * sizeof(Image));
+	queue->pts = malloc(queue->capacity * sizeof(int64_t));
+	queue->serials = malloc(queue->capacity * sizeof(int));
+
+	if(queue->frames == NULL || queue->pts == NULL || queue->serials == NULL)
+		error("failed to allocate memory for frame queue");
+
+	for(int i = 0; i < queue->capacity; i++)
+	{
+		queue->frames[i].width = WIDTH;
+		queue->frames[i].height = HEIGHT;
+		queue->frames[i].pixels = malloc((long)WIDTH * HEIGHT * sizeof(Pixel));
+		queue->frames[i].hashes = malloc(HEIGHT * sizeof(uint64_t));
+		queue->frames[i].glyphs = NULL;
+		if(GLYPHS == 1) allocGlyphs(&queue->frames[i]);
+
+		if(
+			queue->frames[i].pixels == NULL ||
+			queue->frames[i].hashes == NULL
+		)
+			error("failed to allocate memory for frame queue");
+	}
+
+	atomic_init(&queue->head, 0);
+	atomic_init(&queue->tail, 0);
+	atomic_init(&queue->clock, 0);
+	atomic_init(&queue->eof, -1);
+	atomic_init(&queue->quit, 0);
+
+	pthread_mutex_init(&queue->seekLock, NULL);
+	atomic_init(&queue->seeking, 0);
+	queue->seekTo = -1;
+	queue->seekSerial = 0;
+
+	if(pipe(queue->pushed) == -1 || pipe(queue->popped) == -1)
+		error("could not create frame queue pipes");
+
+	// a full pipe already means "wake up", so writes must never block
+	for(int i = 0; i < 2; i++)
+	{
+		fcntl(queue->pushed[i], F_SETFL, O_NONBLOCK);
+		fcntl(queue->popped[i], F_SETFL, O_NONBLOCK);
+	}
+
+	debug(
+		"frame queue: %d frames (%ld KB)",
+		queue->capacity, queue->capacity * frameBytes / 1024
+	);
+}
+
+void freeQueue(FrameQueue *queue)
+{
+	for(int i = 0; i < queue->capacity; i++)
+		freeImage(&queue->frames[i]);
+
+	free(queue->frames);
+	free(queue->pts);
+	free(queue->serials);
+	queue->frames = NULL;
+	queue->pts = NULL;
+	queue->serials = NULL;
+
+	pthread_mutex_destroy(&queue->seekLock);
+
+	for(int i = 0; i < 2; i++)
+	{
+		close(queue->pushed[i]);
+		close(queue->popped[i]);
+	}
+}
+
+// wakes up the side waiting on the pipe (FD is the write end)
+void signalQueue(const int FD)
+{
+	char byte = 0;
+	if(write(FD, &byte, 1) == -1 && errno != EAGAIN)
+		debug("could not signal frame queue");
+}
+
+// sleeps until DEADLINE or until the other side writes to the pipe (FD is
+// the read end) and, if KEYS is 1, until a key is pressed. Spurious wake ups
+// are possible, the caller checks again.
+void waitQueue(const int FD, const int64_t DEADLINE, const int KEYS)
+{
+	waitFor(DEADLINE, FD, KEYS);
+
+	char buffer[64];
+	while(read(FD, buffer, sizeof(buffer)) > 0);
+}
+
+// decoder side: waits for a free slot, returns NULL if the renderer quit or
+// asked for a seek
+Image *reserveFrame(FrameQueue *queue)
+{
+	unsigned long head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+	while(
+		head - atomic_load_explicit(&queue->tail, memory_order_acquire)
+		>= (unsigned long)queue->capacity
+	)
+	{
+		if(atomic_load(&queue->quit) == 1 || atomic_load(&queue->seeking) == 1)
+			return(NULL);
+
+		waitQueue(queue->popped[0], getTime() + QUEUE_WAIT, 0);
+	}
+
+	return(&queue->frames[head % queue->capacity]);
+}
+
+// decoder side: publishes the slot returned by reserveFrame()
+void pushFrame(FrameQueue *queue, const int64_t PTS, const int SERIAL)
+{
+	unsigned long head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+	queue->pts[head % queue->capacity] = PTS;
+	queue->serials[head % queue->capacity] = SERIAL;
+	atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+	signalQueue(queue->pushed[1]);
+}
+
+// renderer side: number of frames ready to be shown
+int queuedFrames(FrameQueue *queue)
+{
+	return(
+		(int)(atomic_load_explicit(&queue->head, memory_order_acquire)
+		- atomic_load_explicit(&queue->tail, memory_order_relaxed))
+	);
+}
+
+// renderer side: the INDEX-th queued frame (0 = oldest)
+Image *queuedFrame(
+	FrameQueue *queue, const int INDEX, int64_t *pts, int *serial
+)
+{
+	unsigned long tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+	int slot = (tail + INDEX) % queue->capacity;
+
+	if(pts != NULL) *pts = queue->pts[slot];
+	if(serial != NULL) *serial = queue->serials[slot];
+	return(&queue->frames[slot]);
+}
+
+// renderer side: hands the COUNT oldest frames back to the decoder
+void popFrames(FrameQueue *queue, const int COUNT)
+{
+	unsigned long tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+	atomic_store_explicit(&queue->tail, tail + COUNT, memory_order_release);
+	signalQueue(queue->popped[1]);
+}
+
+// renderer side: asks the decoder to continue from FRAME and moves the clock
+// there, returns the serial of the frames that will be decoded after the seek
+int requestSeek(FrameQueue *queue, const long FRAME)
+{
+	pthread_mutex_lock(&queue->seekLock);
+	queue->seekTo = FRAME;
+	int serial = ++queue->seekSerial;
+
+	// before the seek is published, or the decoder could take it and still
+	// see the old clock (frames between the two would look late)
+	atomic_store(&queue->clock, FRAME);
+	atomic_store(&queue->seeking, 1);
+	pthread_mutex_unlock(&queue->seekLock);
+
+	signalQueue(queue->popped[1]);
+
+	return(serial);
+}
+
+// decoder side: takes the pending seek request (returns 0 if there is none)
+int takeSeek(FrameQueue *queue, long *frame, int *serial)
+{
+	if(atomic_load(&queue->seeking) == 0)
+		return(0);
+
+	pthread_mutex_lock(&queue->seekLock);
+	*frame = queue->seekTo;
+	*serial = queue->seekSerial;
+	atomic_store(&queue->seeking, 0);
+	pthread_mutex_unlock(&queue->seekLock);
+
+	return(1);
+}
+
+//-------- decode thread -----------------------------------------------------//
+
+typedef struct DecodeThread
+{
+	pthread_t thread;
+	Decoder *decoder;
+	Scaler *scaler;
+	FrameQueue *queue;
+	int fps;
+}DecodeThread;
+
+// how many frames the decoder may fall behind before it stops decoding
+// non-reference frames
+#define SKIP_FRAMES_BEHIND 2
+
+// decodes, scales and queues one frame for every frame time (1 / fps) that
+// has a new frame
+void *decodeLoop(void *arg)
+{
+	DecodeThread *thread = arg;
+	FrameQueue *queue = thread->queue;
+	AVCodecContext *codecCtx = thread->decoder->codecCtx;
+
+	long i = 0;
+	int serial = 0;
+
+	while(atomic_load(&queue->quit) == 0)
+	{
+		long seekTo;
+		if(takeSeek(queue, &seekTo, &serial) == 1)
+		{
+			seekDecoder(thread->decoder, (double)seekTo / thread->fps);
+			codecCtx->skip_frame = AVDISCARD_DEFAULT;
+			i = seekTo;
+		}
+
+		long clock = atomic_load(&queue->clock);
+		long behind = clock - i;
+
+		// frames that are already late are decoded (they may be needed as
+		// references) but never scaled or queued
+		if(behind > 0)
+		{
+			atomic_fetch_add(&stats.dropped, behind);
+			i = clock;
+		}
 
-	float startTime = getTime();
+		// stop decoding frames nothing depends on until the decoder is ahead
+		// of the renderer again
+		if(behind >= SKIP_FRAMES_BEHIND)
+			codecCtx->skip_frame = AVDISCARD_NONREF;
+		else if(behind < 0)
+			codecCtx->skip_frame = AVDISCARD_DEFAULT;
 
-	clear();
+		int64_t time = i * NS_PER_SEC / thread->fps;
+		int result = decodeUntil(thread->decoder, (double)time / NS_PER_SEC);
+
+		// wait at the end of the file, the renderer may still seek back
+		if(result == -1)
+		{
+			atomic_store(&queue->eof, serial);
+			signalQueue(queue->pushed[1]);
+
+			while(
+				atomic_load(&queue->quit) == 0 &&
+				atomic_load(&queue->seeking) == 0
+			)
+				waitQueue(queue->popped[0], getTime() + QUEUE_WAIT, 0);
+
+			continue;
+		}
+
+		if(result == 1)
+		{
+			Image *frame = reserveFrame(queue);
+
+			// quitting or seeking
+			if(frame == NULL)
+				continue;
+
+			scaleFrame(thread->scaler, thread->decoder->frame, frame);
+			pushFrame(queue, time, serial);
+		}
+
+		i++;
+	}
+
+	return(NULL);
+}
+
+//-------- governor ----------------------------------------------------------//
+
+// watches how fast the terminal takes the output (bytes still in the tty
+// output queue, time write() blocked) and trades quality for bandwidth when it
+// falls behind, so frames don't pile up in the pty (ssh, tmux, serial lines)
+
+// quality levels from best to worst: the delta (-d) goes up first, then only
+// every step-th frame is drawn
+const struct {int threshold; int step;} GOVERNOR_LEVELS[] = {
+	{0, 1}, {4, 1}, {8, 1}, {16, 1}, {16, 2}, {24, 3}, {32, 4}
+};
+
+#define GOVERNOR_LEVEL_COUNT 7
+
+// the output is judged every GOVERNOR_WINDOW ns. Quality goes back up after
+// GOVERNOR_CALM windows in a row without a backlog.
+#define GOVERNOR_WINDOW (NS_PER_SEC / 2)
+#define GOVERNOR_CALM 4
+
+typedef struct Governor
+{
+	int enabled;
+	int level; // index into GOVERNOR_LEVELS
+	int threshold; // from -d, never goes below that
+	int cells; // the delta only matters for cells
+
+	int64_t windowStart;
+	long written; // bytes written in this window
+	int64_t blocked; // ns write() blocked in this window
+	int queuedStart; // bytes in the output queue when the window started
+	int calm; // windows in a row without a backlog
+
+	double rate; // bytes / second the terminal read while busy (0 = unknown)
+}Governor;
+
+// bytes written to FD that the terminal hasn't read yet (0 if unknown)
+int outputQueued(const int FD)
+{
+	int queued = 0;
+
+	#ifdef TIOCOUTQ
+	if(ioctl(FD, TIOCOUTQ, &queued) == -1)
+		queued = 0;
+	#endif
+
+	return(queued);
+}
+
+void initGovernor(Governor *governor, const Settings SETTINGS)
+{
+	governor->enabled = SETTINGS.adapt;
+	governor->level = 0;
+	governor->threshold = SETTINGS.threshold;
+	governor->cells = SETTINGS.graphics == GRAPHICS_CELLS;
+
+	governor->windowStart = getTime();
+	governor->written = 0;
+	governor->blocked = 0;
+	governor->queuedStart = outputQueued(STDOUT_FILENO);
+	governor->calm = 0;
+	governor->rate = 0;
+}
+
+// the delta (-d) for the current level
+int governorThreshold(const Governor *GOVERNOR)
+{
+	return(max(GOVERNOR->threshold, GOVERNOR_LEVELS[GOVERNOR->level].threshold));
+}
+
+// min ns between drawn frames (0 = draw every frame). Half a frame short of
+// the step, so the frame that is due then isn't missed by a hair.
+int64_t governorInterval(const Governor *GOVERNOR, const int FPS)
+{
+	int step = GOVERNOR_LEVELS[GOVERNOR->level].step;
+	if(step == 1)
+		return(0);
+
+	return((step * NS_PER_SEC - NS_PER_SEC / 2) / FPS);
+}
+
+// one level worse (DIRECTION = 1) or better (-1). For graphics the delta
+// doesn't matter, only the levels where the step changes count.
+void moveGovernor(Governor *governor, const int DIRECTION)
+{
+	int level = governor->level;
+
+	do
+		level += DIRECTION;
+	while(
+		governor->cells == 0 &&
+		level > 0 && level < GOVERNOR_LEVEL_COUNT - 1 &&
+		GOVERNOR_LEVELS[level].step == GOVERNOR_LEVELS[level - 1].step
+	);
+
+	if(level >= 0 && level < GOVERNOR_LEVEL_COUNT)
+		governor->level = level;
+}
+
+// call after every frame with the bytes written and the ns write() took.
+// Returns 1 if the level changed.
+int governFrame(Governor *governor, const int BYTES, const int64_t BLOCKED)
+{
+	if(governor->enabled == 0)
+		return(0);
+
+	governor->written += BYTES;
+	governor->blocked += BLOCKED;
+
+	int64_t now = getTime();
+	int64_t elapsed = now - governor->windowStart;
+	if(elapsed < GOVERNOR_WINDOW)
+		return(0);
+
+	int queued = outputQueued(STDOUT_FILENO);
+
+	// write() had to wait for room, or more than a couple of frames are still
+	// waiting to be read
+	int backlog = governor->blocked > elapsed / 10
+		|| queued > max(16384, 2 * BYTES);
+
+	int level = governor->level;
+
+	if(backlog == 1)
+	{
+		// the terminal was busy the whole window, so what it read is its speed
+		double rate = (double)(governor->queuedStart + governor->written - queued)
+			* NS_PER_SEC / elapsed;
+		governor->rate = governor->rate == 0
+			? rate : (governor->rate + rate) / 2;
+
+		moveGovernor(governor, 1);
+		governor->calm = 0;
+	}
+	else if(++governor->calm >= GOVERNOR_CALM && governor->level > 0)
+	{
+		// only go back up with room for the extra output
+		double sent = (double)governor->written * NS_PER_SEC / elapsed;
+		if(governor->rate == 0 || sent < governor->rate / 2)
+			moveGovernor(governor, -1);
+		governor->calm = 0;
+	}
+
+	governor->windowStart = now;
+	governor->written = 0;
+	governor->blocked = 0;
+	governor->queuedStart = queued;
+
+	stats.quality = governor->level;
+	stats.worstQuality = max(stats.worstQuality, governor->level);
+	stats.drainRate = governor->rate;
+
+	return(governor->level != level);
+}
+
+//-------- player ------------------------------------------------------------//
+
+void playVideo(
+	FrameQueue *queue, const VideoInfo INFO, const char INPUT[],
+	const AudioStream *AUDIO, const int BAR, const Settings SETTINGS
+)
+{
+	int height = getWinHeight();
+
+	Image prevImage;
+	prevImage.width = INFO.width;
+	prevImage.height = INFO.height;
+
+	// what is on screen, the encoder draws the first frame in full
+	prevImage.pixels
+		= (Pixel*)malloc((INFO.width * INFO.height) * sizeof(Pixel));
+	prevImage.hashes = NULL;
+	prevImage.glyphs = NULL;
+
+	if(prevImage.pixels == NULL)
+		error("failed to allocate memory for prevImage");
+
+	if(SETTINGS.mode != MODE_HALF)
+		allocGlyphs(&prevImage);
+
+	debug("allocated memory for prevImage");
+
+	Encoder encoder;
+	initEncoder(&encoder, INFO.width, INFO.height, SETTINGS);
+
+	// wide frames are encoded in bands by several threads
+	Workers encodeWorkers;
+	int threads = SETTINGS.graphics == GRAPHICS_CELLS
+		? encodeThreads(INFO.width, INFO.height, SETTINGS.threads) : 1;
+
+	if(threads > 1)
+	{
+		startWorkers(&encodeWorkers, threads);
+		shareEncoder(&encoder, &encodeWorkers);
+	}
+
+	Sixel sixel;
+	if(SETTINGS.graphics == GRAPHICS_SIXEL)
+		initSixel(&sixel, queue->frames[0].width, queue->frames[0].height);
+
+	Kitty kitty;
+	if(SETTINGS.graphics == GRAPHICS_KITTY)
+		initKitty(
+			&kitty, queue->frames[0].width, queue->frames[0].height,
+			probeKittyShm()
+		);
+
+	// the terminal shows each frame once it is complete instead of redrawing
+	// while it arrives (no tearing, and less work for the terminal)
+	int sync = SETTINGS.sync == 1 && probeSyncOutput();
+	debug("synchronized output: %d", sync);
+
+	// sized for a full redraw plus the progress bar
+	OutBuf out;
+	initOutBuf(
+		&out, INFO.width * INFO.height / 2 * MAX_CELL_BYTES + INFO.width * 4 + 64
+	);
+
+	debug("starting audio and video (%d fps)", INFO.fps);
+
+	// wait for the first frame (the decoder takes time to start)
+	while(queuedFrames(queue) == 0 && atomic_load(&queue->eof) == -1)
+		waitQueue(queue->pushed[0], getTime() + QUEUE_WAIT, 0);
+
+	if(AUDIO->stream >= 0) playAudio(INPUT, AUDIO);
+
+	// all times are in ns on the monotonic clock
+	int64_t startTime = getTime();
+	long shownFrame = -1;
+	int serial = 0;
+
+	int64_t playStart = startTime;
+	int64_t cpuStart = getCpuTime();
 
-	if(SOUND == 1) playAudio(audioDir);
+	Governor governor;
+	initGovernor(&governor, SETTINGS);
+	stats.governed = governor.enabled;
+	int64_t lastDraw = 0;
+
+	clear();
+	enableRawMode();
 
 	while(1)
 	{
-		float time = getTime() - startTime;
-		char file[1000];
-		int currentFrame = (int)floor(INFO.fps * time);
-		// frames start from 1
-		if(currentFrame < 1)currentFrame = 1;
+		int64_t time = getTime() - startTime;
+
+		// follow the audio while there is some, the wall clock is kept in
+		// step so it can take over if the audio ends first
+		int64_t audioTime = getAudioClock();
+		if(audioTime >= 0)
+		{
+			time = audioTime;
+			startTime = getTime() - time;
+		}
+
+		long currentFrame = (long)(time * INFO.fps / NS_PER_SEC);
+
+		if(time > INFO.duration)
+			break;
 
-		sprintf(file, "%s/frame%d.bmp", TMP_FOLDER, currentFrame);
+		enum Key key = readKey();
 
-		if(access(file, F_OK) != - 1)
+		if(key != KEY_NONE)
 		{
-			Image currentImage = loadImage(file);
-			updateScreen(currentImage, prevImage);
-			prevImage = copyImage(currentImage);
-			freeImage(&currentImage);
+			int64_t target = time;
+			if(key == KEY_LEFT) target -= SEEK_STEP * NS_PER_SEC;
+			if(key == KEY_RIGHT) target += SEEK_STEP * NS_PER_SEC;
+			if(key == KEY_UP) target += SEEK_STEP_LONG * NS_PER_SEC;
+			if(key == KEY_DOWN) target -= SEEK_STEP_LONG * NS_PER_SEC;
+
+			if(target < 0) target = 0;
+			if(target > INFO.duration) target = INFO.duration;
+
+			long frame = (long)(target * INFO.fps / NS_PER_SEC);
+			serial = requestSeek(queue, frame);
+
+			// restart the clock from the target
+			startTime = getTime() - frame * NS_PER_SEC / INFO.fps;
+			shownFrame = -1;
+			lastDraw = 0;
+
+			seekAudio(frame * NS_PER_SEC / INFO.fps);
+			continue;
 		}
-		else
+
+		// nothing to do until the next frame is due
+		if(currentFrame == shownFrame)
 		{
-			error("next file (%s) not found", file);
-			freeImage(&prevImage);
-			break;
+			int64_t sleepStart = getTime();
+			waitUntil(startTime + (currentFrame + 1) * NS_PER_SEC / INFO.fps);
+			stats.idleTime += getTime() - sleepStart;
+			continue;
 		}
 
-		if(time > INFO.duration)
+		// lets the decoder know which frames are already late
+		atomic_store(&queue->clock, currentFrame);
+
+		int queued = queuedFrames(queue);
+
+		// throw away frames decoded before the last seek
+		while(queued > 0)
 		{
-			freeImage(&prevImage);
+			int frameSerial;
+			queuedFrame(queue, 0, NULL, &frameSerial);
+			if(frameSerial == serial) break;
+			popFrames(queue, 1);
+			queued--;
+		}
+
+		if(queued == 0 && atomic_load(&queue->eof) == serial)
 			break;
+
+		// find the newest queued frame that is due, older ones are skipped
+		int due = -1;
+		for(int i = 0; i < queued; i++)
+		{
+			int64_t pts;
+			queuedFrame(queue, i, &pts, NULL);
+			if(pts > time) break;
+			due = i;
+		}
+
+		// the next frame is not due yet (sleep until it is) or the decoder is
+		// behind (sleep until it queues one)
+		if(due == -1)
+		{
+			int64_t sleepStart = getTime();
+
+			if(queued > 0)
+			{
+				int64_t pts;
+				queuedFrame(queue, 0, &pts, NULL);
+				waitUntil(startTime + pts);
+			}
+			else
+				waitQueue(queue->pushed[0], sleepStart + QUEUE_WAIT, 1);
+
+			stats.idleTime += getTime() - sleepStart;
+			continue;
+		}
+
+		// the governor lowers the fps by leaving frames out
+		int64_t nextDraw = lastDraw + governorInterval(&governor, INFO.fps);
+		if(getTime() < nextDraw)
+		{
+			int64_t sleepStart = getTime();
+			waitUntil(nextDraw);
+			stats.idleTime += getTime() - sleepStart;
+			continue;
+		}
+
+		shownFrame = currentFrame;
+		lastDraw = getTime();
+
+		int64_t pts;
+		Image *currentImage = queuedFrame(queue, due, &pts, NULL);
+
+		// begin synchronized update
+		if(sync == 1)
+			putString(&out, "\033[?2026h");
+
+		if(SETTINGS.graphics == GRAPHICS_SIXEL)
+		{
+			putString(&out, "\033[?25l\033[H");
+			putSixel(&sixel, &out, *currentImage);
 		}
+		else if(SETTINGS.graphics == GRAPHICS_KITTY)
+		{
+			putString(&out, "\033[?25l\033[H");
+			putKitty(&kitty, &out, *currentImage);
+		}
+		else
+			updateScreen(&encoder, &out, *currentImage, prevImage);
+
+		stats.shown++;
+		stats.playTime = getTime() - playStart;
+		stats.cpuTime = getCpuTime() - cpuStart;
+		if(audioTime >= 0) addAVOffset(pts - audioTime);
+
+		// the frames before the one shown were late and are skipped
+		atomic_fetch_add(&stats.dropped, due);
+		popFrames(queue, due + 1);
 
 		if(BAR == 0)
 		{
 			//move cursor to bottom left
-			printf("\033[%d;%dH", height, 0);
+			putCursor(&out, height, 0);
 
 			// reset colors
-			printf("\e[40m\e[97m");
+			putString(&out, "\e[40m\e[97m");
+
+			int seconds = (int)(time / NS_PER_SEC);
+			int totalSeconds = (int)(INFO.duration / NS_PER_SEC);
 
 			//print time
-			printf(
-				"%02d:%02d / %02d:%02d ",
-				(int)(time / 60),
-				(int)time % 60,
-				(int)(INFO.duration / 60),
-				(int)INFO.duration % 60
+			char text[64];
+			int length = snprintf(
+				text, sizeof(text), "%02d:%02d / %02d:%02d ",
+				seconds / 60,
+				seconds % 60,
+				totalSeconds / 60,
+				totalSeconds % 60
 			);
+			putBytes(&out, text, length);
 
-			int offset = max(2, getDigits((int)(time / 60)))
-				+ max(2, getDigits((int)(INFO.duration / 60))) + 11;
+			int offset = max(2, getDigits(seconds / 60))
+				+ max(2, getDigits(totalSeconds / 60)) + 11;
 
-			int lineLength
-				= (int)((float)(INFO.width - offset) * (time / INFO.duration));
+			int lineLength = INFO.duration > 0
+				? (int)((INFO.width - offset) * time / INFO.duration) : 0;
 
 			// print red bar
-			printf("\e[31m");
+			putString(&out, "\e[31m");
 			for(int i = 0; i < lineLength; i++)
 			{
-				printf("▬");
+				putString(&out, "▬");
 			}
 
 			// print gray bar
-			printf("\e[90m");
+			putString(&out, "\e[90m");
 			for(int i = 0; i < INFO.width - offset - lineLength; i++)
 			{
-				printf("▬");
+				putString(&out, "▬");
 			}
 		}
 
+		// end synchronized update
+		if(sync == 1)
+			putString(&out, "\033[?2026l");
+
+		// the whole frame goes out in one write
+		int64_t writeStart = getTime();
+		int bytes = flushOutBuf(&out, STDOUT_FILENO);
+
+		if(governFrame(&governor, bytes, getTime() - writeStart) == 1)
+		{
+			int threshold = governorThreshold(&governor);
+
+			// cells held back at the higher threshold are diffed against the
+			// screen again (no rows skipped by hash in the next frame)
+			if(threshold * threshold < encoder.threshold)
+				encoder.hashCount = 0;
+
+			encoder.threshold = threshold * threshold;
+		}
 	}
+	stats.playTime = getTime() - playStart;
+	stats.cpuTime = getCpuTime() - cpuStart;
+
+	disableRawMode();
+	freeOutBuf(&out);
+	freeEncoder(&encoder);
 	freeImage(&prevImage);
+
+	if(threads > 1)
+		stopWorkers(&encodeWorkers);
+
+	if(SETTINGS.graphics == GRAPHICS_SIXEL)
+		freeSixel(&sixel);
+	else if(SETTINGS.graphics == GRAPHICS_KITTY)
+		freeKitty(&kitty);
 }
 
-VideoInfo getVideoInfo(const char TARGET[])
+//-------- benchmark ---------------------------------------------------------//
+
+// encodes every decoded frame (as fast as possible, nothing is shown) and
+// prints how the encoders did
+void benchVideo(
+	FrameQueue *queue, const VideoInfo INFO, const Settings SETTINGS
+)
 {
-	av_register_all();
+	// the frames are in pixels for the graphics protocols
+	Bench bench;
+	initBench(
+		&bench, queue->frames[0].width, queue->frames[0].height, SETTINGS
+	);
 
-	VideoInfo info;
+	debug("benchmarking encoders");
 
-	AVFormatContext *formatCtx = avformat_alloc_context();
+	while(1)
+	{
+		if(queuedFrames(queue) == 0)
+		{
+			if(atomic_load(&queue->eof) == 0)
+				break;
 
-	if(formatCtx == NULL)
-		error("failed to allocate memory for formatCtx");
+			waitQueue(queue->pushed[0], getTime() + QUEUE_WAIT, 0);
+			continue;
+		}
 
-	debug("allocated memory for formatCtx");
+		benchFrame(&bench, *queuedFrame(queue, 0, NULL, NULL));
+		popFrames(queue, 1);
+	}
 
-	if(avformat_open_input(&formatCtx, TARGET, NULL, NULL) < 0)
-		error("failed to open file");
+	printBench(&bench);
+	freeBench(&bench);
+}
 
-	avformat_find_stream_info(formatCtx,  NULL);
+// reads the video info from the stream opened by openDecoder()
+VideoInfo getVideoInfo(const Decoder *DECODER)
+{
+	VideoInfo info;
 
-	int index = 0;
+	AVStream *stream = DECODER->formatCtx->streams[DECODER->stream];
 
-	for (int i = 0; i < formatCtx->nb_streams; i++)
-	{
-		AVCodecParameters *codecPram = formatCtx->streams[i]->codecpar;
-		if (codecPram->codec_type == AVMEDIA_TYPE_VIDEO) {
-			info.width = codecPram->width;
-			info.height = codecPram->height;
-			index = i;
-			break;
-		}
-	}
+	info.width = stream->codecpar->width;
+	info.height = stream->codecpar->height;
 
-	info.fps = formatCtx->streams[index]->r_frame_rate.num;
-	info.duration = formatCtx->duration / AV_TIME_BASE;
+	// r_frame_rate is a fraction (e.g. 30000/1001)
+	info.fps = (int)(av_q2d(stream->r_frame_rate) + 0.5);
+	if(info.fps <= 0) info.fps = DEFAULT_FPS;
+	info.duration
+		= av_rescale(DECODER->formatCtx->duration, NS_PER_SEC, AV_TIME_BASE);
 
 	debug(
 		"got video info: %d * %d, fps = %d, time = %f[min]",
 		info.width, info.height, info.fps,
-		info.duration / 60
+		(double)info.duration / NS_PER_SEC / 60
 	);
 
-	free(formatCtx);
-
 	return(info);
 }
 
+// copies the best audio stream's info from the stream opened by openDecoder()
+// (before the decode thread starts using it)
+AudioStream getAudioStream(const Decoder *DECODER)
+{
+	AudioStream audioStream = {-1, NULL, 0, 0};
+
+	int index = av_find_best_stream(
+		DECODER->formatCtx, AVMEDIA_TYPE_AUDIO, -1, -1, NULL, 0
+	);
+
+	if(index < 0)
+		return(audioStream);
+
+	AVStream *stream = DECODER->formatCtx->streams[index];
+
+	audioStream.codecpar = avcodec_parameters_alloc();
+
+	if(
+		audioStream.codecpar == NULL ||
+		avcodec_parameters_copy(audioStream.codecpar, stream->codecpar) < 0
+	)
+		error("failed to allocate memory for audio stream info");
+
+	audioStream.stream = index;
+	audioStream.timeBase = av_q2d(stream->time_base);
+	audioStream.startPts
+		= stream->start_time == AV_NOPTS_VALUE ? 0 : stream->start_time;
+
+	return(audioStream);
+}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 // Cleanup
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 void cleanup()
 {
-	// move cursor to bottom right and reset colors and show cursor
-	printf("\x1b[0m\033[?25h\033[%d;%dH\n", getWinWidth(), getWinHeight());
+	disableRawMode();
+	stopAudio();
+
+	// end a synchronized update that was cut off, reset colors, show cursor
+	// and move it to the bottom right
+	printf(
+		"\033[?2026l\x1b[0m\033[?25h\033[%d;%dH\n",
+		getWinWidth(), getWinHeight()
+	);
+
+	printStats();
+
+	// kitty frames the terminal didn't read
+	for(int i = 0; i < KITTY_SHM_OBJECTS; i++)
+	{
+		char name[64];
+		kittyShmName(name, sizeof(name), i);
+		shm_unlink(name);
+	}
+
 	char dirName[] = TMP_FOLDER;
 
 	debug("tmp folder: %s", dirName);
@@ -856,8 +6109,6 @@ void cleanup()
 
 	debug("deleted %d images", count);
 
-	stopAudio();
-
 	exit(0);
 }
 
@@ -870,16 +6121,20 @@ void cleanup()
 void video(
 	const int WIDTH, const int HEIGHT,
 	const int FPS, const int FLAG, const char INPUT[],
-	const int SOUND, const int BAR
+	const int SOUND, const int BAR, const Settings SETTINGS
 )
 {
 	debug("target: %s", INPUT);
 
-	//check if ffmpeg is installed
-	if(system("ffmpeg -h >>/dev/null 2>>/dev/null") != 0)
-		error("ffmpeg is not installed");
+	// opening the decoder also probes the stream for getVideoInfo()
+	Decoder decoder;
+	openDecoder(&decoder, INPUT, SETTINGS.threads);
 
-	VideoInfo info = getVideoInfo(INPUT);
+	VideoInfo info = getVideoInfo(&decoder);
+
+	AudioStream audioStream = {-1, NULL, 0, 0};
+	if(SOUND == 1 && SETTINGS.benchmark == 0)
+		audioStream = getAudioStream(&decoder);
 
 	float zoomX, zoomY;
 	if(WIDTH == -1 && HEIGHT == -1)
@@ -911,76 +6166,78 @@ void video(
 	info.width *= zoomX;
 	info.height *= zoomY;
 
+	// graphics get the frames in pixels (info stays in cells for the bar)
+	int frameWidth = info.width;
+	int frameHeight = info.height;
+
+	if(SETTINGS.graphics != GRAPHICS_CELLS)
+	{
+		int cellWidth, cellHeight;
+		getCellSize(&cellWidth, &cellHeight);
+
+		// the last line is for the progress bar
+		int rows = max(1, min(info.height / 2, getWinHeight() / 2 - 1));
+		frameWidth = (long)info.width * cellWidth * rows
+			/ max(1, info.height / 2);
+		frameHeight = rows * cellHeight;
+	}
+
 	if(FLAG == 0)
 		info.fps = DEFAULT_FPS;
 
 	if(FPS != -1)
 		info.fps = FPS;
 
-	char dir[] = TMP_FOLDER;
-
-	debug("tmp folder: %s", dir);
-
-	struct stat sb;
-
-	// make /tmp/tmv folder if none exists
-	if(stat(dir, &sb) != 0)
-	{
-		debug("could not find tmp folder");
-		mkdir(dir, 0700);
-		debug("created tmp folder: %s", dir);
-	}
+	Workers workers;
+	startWorkers(&workers, SETTINGS.threads);
 
-	// decode video with ffmpeg into audio
-	char commandA[1000];
-	sprintf(
-		commandA,
-		"ffmpeg -i \"%s\" -f wav \"%s/audio.wav\" >>/dev/null 2>>/dev/null",
-		INPUT, dir
-	);
+	Palette palette = {0};
+	if(SETTINGS.colors != COLORS_TRUE)
+		initPalette(&palette, SETTINGS.colors, SETTINGS.dither);
 
-	debug("audio command: %s", commandA);
+	Scaler scaler = {0};
+	scaler.workers = &workers;
+	scaler.palette = SETTINGS.colors != COLORS_TRUE ? &palette : NULL;
+	scaler.glyphs = getGlyphs(SETTINGS.mode);
 
-	// decode video with ffmpeg into bmp files
-	char commandB[1000];
-	sprintf(
-		commandB,
-		"ffmpeg -i \"%s\" -vf \"fps=%d, scale=%d:%d\" \"%s/frame%%d.bmp\"\
- >>/dev/null 2>>/dev/null",
-		INPUT, info.fps, (int)(info.width), (int)(info.height),
-		dir
+	FrameQueue queue;
+	initQueue(
+		&queue, frameWidth, frameHeight, SETTINGS.mode != MODE_HALF,
+		SETTINGS.queueFrames, SETTINGS.queueMB
 	);
 
-	debug("video command: %s", commandB);
-
-	debug("forking");
-
-	// child = plays video, parent = decodes
-	int pid = fork();
+	DecodeThread thread;
+	thread.decoder = &decoder;
+	thread.scaler = &scaler;
+	thread.queue = &queue;
+	thread.fps = info.fps;
 
-	if(pid == 0)
-	{
+	if(pthread_create(&thread.thread, NULL, decodeLoop, &thread) != 0)
+		error("could not start decode thread");
 
-		char TARGET[1000];
-		sprintf(TARGET, "%s/frame%d.bmp", dir, 1);
-		// wait for first image (ffmpeg takes time to start)
-		while(access(TARGET, F_OK) == -1){}
-		// play the video
-		playVideo(info, SOUND, BAR);
-	}
+	if(SETTINGS.benchmark == 1)
+		benchVideo(&queue, info, SETTINGS);
 	else
-	{
-		// audio first
-		system(commandA);
-		system(commandB);
-		// wait for video to finish
-		wait(NULL);
-	}
+		playVideo(&queue, info, INPUT, &audioStream, BAR, SETTINGS);
+
+	atomic_store(&queue.quit, 1);
+	signalQueue(queue.popped[1]);
+	pthread_join(thread.thread, NULL);
+
+	freeQueue(&queue);
+	freeScaler(&scaler);
+	freePalette(&palette);
+	stopWorkers(&workers);
+	avcodec_parameters_free(&audioStream.codecpar);
+	closeDecoder(&decoder);
 }
 
 //---- image -----------------------------------------------------------------//
 
-void image(const int WIDTH, const int HEIGHT, const char INPUT[])
+void image(
+	const int WIDTH, const int HEIGHT, const char INPUT[],
+	const Settings SETTINGS
+)
 {
 	debug("target image: %s", INPUT);
 
@@ -1019,7 +6276,45 @@ void image(const int WIDTH, const int HEIGHT, const char INPUT[])
 
 	debug("zoom: x: %f, y: %f", zoomX, zoomY);
 
-	image = scaleImage(image, zoomX, zoomY);
+	const Glyphs *glyphs = getGlyphs(SETTINGS.mode);
+
+	if(SETTINGS.graphics != GRAPHICS_CELLS)
+	{
+		// every pixel of the cells is drawn (the zoom is for 1 * 2 per cell)
+		int cellWidth, cellHeight;
+		getCellSize(&cellWidth, &cellHeight);
+
+		// leave the last line free, so the image doesn't scroll up
+		if(WIDTH == -1 && HEIGHT == -1)
+		{
+			int rows = getWinHeight() / 2;
+			zoomX = zoomX * (rows - 1) / rows;
+			zoomY = zoomY * (rows - 1) / rows;
+		}
+
+		image = scaleImage(image, zoomX * cellWidth, zoomY * cellHeight / 2);
+	}
+	else if(glyphs == NULL)
+		image = scaleImage(image, zoomX, zoomY);
+	else
+	{
+		// scale to sub-pixels (a cell is 1 * 2 pixels) and fit the cells
+		Image sub = scaleImage(
+			image, zoomX * glyphs->width, zoomY * glyphs->height / 2
+		);
+		image = fitImage(glyphs, sub);
+		freeImage(&sub);
+	}
+
+	if(SETTINGS.colors != COLORS_TRUE)
+	{
+		Palette palette;
+		initPalette(&palette, SETTINGS.colors, SETTINGS.dither);
+
+		ditherRows(&palette, &image, 0, image.height);
+
+		freePalette(&palette);
+	}
 
 	Image prevImage;
 	prevImage.width = image.width;
@@ -1027,27 +6322,82 @@ void image(const int WIDTH, const int HEIGHT, const char INPUT[])
 
 	prevImage.pixels
 		= (Pixel*)malloc((image.width * image.height) * sizeof(Pixel));
+	prevImage.hashes = NULL;
+	prevImage.glyphs = NULL;
 
 	if(prevImage.pixels == NULL)
 		error("failed to allocate memory for prevImage");
 
+	if(SETTINGS.mode != MODE_HALF)
+		allocGlyphs(&prevImage);
+
 	debug("allocated memory for prevImage");
 
-	// initialize all colors to -1 to force update when calling updateScreen()
-	for(int i = 0; i < image.height; i++)
+	OutBuf out;
+	initOutBuf(
+		&out,
+		SETTINGS.graphics == GRAPHICS_CELLS
+			? image.width * image.height / 2 * MAX_CELL_BYTES + 64
+			: image.width * image.height + 64
+	);
+
+	if(SETTINGS.benchmark == 1)
 	{
-		for(int j = 0; j < image.width; j++)
+		// encode the same image over and over as full redraws
+		Bench bench;
+		initBench(&bench, image.width, image.height, SETTINGS);
+
+		for(int i = 0; i < BENCH_RUNS; i++)
 		{
-			prevImage.pixels[i * image.width + j].r = -1;
-			prevImage.pixels[i * image.width + j].g = -1;
-			prevImage.pixels[i * image.width + j].b = -1;
+			bench.full = 1;
+			benchFrame(&bench, image);
 		}
+
+		printBench(&bench);
+		freeBench(&bench);
 	}
+	else if(SETTINGS.graphics == GRAPHICS_SIXEL)
+	{
+		Sixel sixel;
+		initSixel(&sixel, image.width, image.height);
 
-	clear();
+		clear();
+
+		putString(&out, "\033[H");
+		putSixel(&sixel, &out, image);
+		putChar(&out, '\n');
+		flushOutBuf(&out, STDOUT_FILENO);
+
+		freeSixel(&sixel);
+	}
+	else if(SETTINGS.graphics == GRAPHICS_KITTY)
+	{
+		Kitty kitty;
+		initKitty(&kitty, image.width, image.height, probeKittyShm());
+
+		clear();
+
+		putString(&out, "\033[H");
+		putKitty(&kitty, &out, image);
+		flushOutBuf(&out, STDOUT_FILENO);
+
+		freeKitty(&kitty);
+	}
+	else
+	{
+		Encoder encoder;
+		initEncoder(&encoder, image.width, image.height, SETTINGS);
 
-	updateScreen(image, prevImage);
+		clear();
 
+		updateScreen(&encoder, &out, image, prevImage);
+		flushOutBuf(&out, STDOUT_FILENO);
+
+		freeEncoder(&encoder);
+	}
+
+	freeOutBuf(&out);
+	freeImage(&prevImage);
 	freeImage(&image);
 }
 
@@ -1056,7 +6406,7 @@ void image(const int WIDTH, const int HEIGHT, const char INPUT[])
 void youtube(
 	const int WIDTH, const int HEIGHT,
 	const int FPS, const int FLAG, const char INPUT[],
-	const int SOUND, const int BAR
+	const int SOUND, const int BAR, const Settings SETTINGS
 )
 {
 	//check if youtube-dl is installed
@@ -1093,12 +6443,13 @@ void youtube(
 
 	sprintf(dir, "%s/video.mp4", TMP_FOLDER);
 
-	// wait for first image (ffmpeg takes time to start)
-	while(access(dir, F_OK) == -1){}
+	// youtube-dl has exited, so the file is complete (or missing)
+	if(access(dir, F_OK) == -1)
+		error("could not find downloaded video");
 
 	debug("finished downloading video");
 
-	video(WIDTH, HEIGHT, FPS, FLAG, dir, SOUND, BAR);
+	video(WIDTH, HEIGHT, FPS, FLAG, dir, SOUND, BAR, SETTINGS);
 }
 
 //---- main ------------------------------------------------------------------//
@@ -1119,16 +6470,38 @@ int main(int argc, char *argv[])
 	args.sound = 1;
 	args.youtube = 0;
 	args.bar = 0;
+	args.settings.queueFrames = QUEUE_FRAMES;
+	args.settings.queueMB = QUEUE_MB;
+	args.settings.threads = getCoreCount();
+	args.settings.rep = 1;
+	args.settings.adapt = 1;
+	args.settings.sync = 1;
+	args.settings.scroll = 1;
+	args.settings.colors = detectColors();
+	args.settings.dither = DITHER_ORDERED;
+	args.settings.mode = MODE_HALF;
+	args.settings.graphics = GRAPHICS_CELLS;
 
 	argp_parse(&argp, argc, argv, 0, 0, &args);
 
+	// ascii needs the real colors for the brightness and draws none
+	if(args.settings.mode == MODE_ASCII)
+		args.settings.colors = COLORS_TRUE;
+
+	// graphics get the full colors and pick their own palette
+	if(args.settings.graphics != GRAPHICS_CELLS)
+	{
+		args.settings.colors = COLORS_TRUE;
+		args.settings.mode = MODE_HALF;
+	}
+
 	if(args.youtube == 1)
 	{
 		debug("youtube mode");
 		youtube(
 			args.width, args.height, args.fps,
 			args.fpsFlag, args.input,
-			args.sound, args.bar
+			args.sound, args.bar, args.settings
 		);
 	}
 	else
@@ -1145,12 +6518,12 @@ int main(int argc, char *argv[])
 		int fileType = checkFileType(ext);
 
 		if(fileType == 1)
-			image(args.width, args.height, args.input);
+			image(args.width, args.height, args.input, args.settings);
 		else if(fileType == 2)
 			video(
 				args.width, args.height, args.fps,
 				args.fpsFlag, args.input,
-				args.sound, args.bar
+				args.sound, args.bar, args.settings
 			);
 		else
 			error("invalid file type");